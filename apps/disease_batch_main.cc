@@ -0,0 +1,272 @@
+#include <core/batch_runner.h>
+#include <core/ensemble.h>
+#include <core/parameter_sweep.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+using disease::BatchRunner;
+using disease::Disease;
+using disease::Ensemble;
+using disease::FeatureSettings;
+using disease::ParameterSweep;
+
+namespace {
+
+void PrintUsage(const char* program_name) {
+  std::cerr << "Usage: " << program_name << " [options]\n"
+            << "  --output <file>            File to write the counts to (default: stdout)\n"
+            << "  --ticks <n>                Number of ticks to run (default: 1000)\n"
+            << "  --population <n>           Number of susceptible people (default: 200)\n"
+            << "  --seed <n>                 Seed for the random values (same seed, same run)\n"
+            << "  --world-width <n>          Width of the container (default: 550)\n"
+            << "  --world-height <n>         Height of the container (default: 580)\n"
+            << "  --particle-radius <n>      Radius of each person's particle (default: 10)\n"
+            << "  --quarantine               Quarantine people who show symptoms\n"
+            << "  --exposure-time <n>        Exposure time to be infected\n"
+            << "  --infected-time <n>        Infected time to be removed\n"
+            << "  --social-distance <n>      Percent of the population social distancing\n"
+            << "  --infection-radius <n>     Radius of infection\n"
+            << "  --central-location         Have a central location\n"
+            << "  --two-phase                Update everyone from the start of each tick\n"
+            << "  --threads <n>              Threads to run two phase updates on (default: 1)\n"
+            << "  --reorder-interval <n>     Sort the population by position every n ticks, so\n"
+            << "                             neighbors are stored together (default: 0, never)\n"
+            << "  --single-precision         Compare distances in single precision (faster, but\n"
+            << "                             runs differ slightly from the default)\n"
+            << "  --replicates <n>           Run n copies with different seeds and write the mean,\n"
+            << "                             standard deviation, and percentiles of each tick\n"
+            << "  --replicate-threads <n>    Threads to run replicates on (default: all cores)\n"
+            << "  --sweep <grid|lhs>         Run every combination of the features (grid), or a\n"
+            << "                             Latin hypercube sample of them (lhs), and write one\n"
+            << "                             row per run instead of the counts of every tick\n"
+            << "  --samples <n>              Number of settings sampled by --sweep lhs (default: 1000)\n"
+            << "  --sweep-threads <n>        Threads to make sweep runs on (default: all cores)\n"
+            << "  --profile                  Write the average time of each phase of a tick to stderr\n"
+            << "                             (needs a build with DISEASE_ENABLE_PROFILING)\n";
+}
+
+/*
+ * Parses a non-negative integer argument.
+ *
+ * @param argument The argument to parse
+ * @param value Where to store the parsed value
+ * @return A bool representing if the argument is a valid non-negative integer
+ */
+bool ParseSize(const char* argument, size_t& value) {
+  char* end;
+  long long parsed = std::strtoll(argument, &end, 10);
+  if (*argument == '\0' || *end != '\0' || parsed < 0) {
+    return false;
+  }
+  value = size_t(parsed);
+  return true;
+}
+
+/*
+ * Checks that a feature value is within the range the simulator allows.
+ */
+bool IsWithinRange(const string& option, size_t value, size_t minimum, size_t maximum) {
+  if (value < minimum || value > maximum) {
+    std::cerr << option << " must be between " << minimum << " and " << maximum << "\n";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  BatchRunner runner;
+  Disease& disease = runner.GetDisease();
+
+  size_t num_of_ticks = 1000;
+  string output_path;
+  bool should_profile = false;
+  size_t num_of_replicates = 0;
+  size_t num_of_replicate_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  string sweep_type;
+  size_t num_of_samples = 1000;
+  size_t num_of_sweep_threads = num_of_replicate_threads;
+  vec2 world_size = disease.GetContainerBottomRight() - disease.GetContainerTopLeft();
+
+  for (int i = 1; i < argc; i++) {
+    string option = argv[i];
+
+    if (option == "--quarantine") {
+      disease.SetShouldQuarantine(true);
+      continue;
+    } else if (option == "--central-location") {
+      disease.SetHaveCentralLocation(true);
+      continue;
+    } else if (option == "--two-phase") {
+      disease.SetShouldUpdateInTwoPhases(true);
+      continue;
+    } else if (option == "--single-precision") {
+      disease.SetPrecision(Disease::Precision::kSingle);
+      continue;
+    } else if (option == "--profile") {
+      if (!disease::TickProfiler::kIsEnabled) {
+        std::cerr << "--profile needs a build with DISEASE_ENABLE_PROFILING\n";
+        return 1;
+      }
+      should_profile = true;
+      continue;
+    } else if (option == "--help") {
+      PrintUsage(argv[0]);
+      return 0;
+    }
+
+    // Every other option takes a value
+    if (i + 1 >= argc) {
+      PrintUsage(argv[0]);
+      return 1;
+    }
+    const char* argument = argv[++i];
+
+    if (option == "--output") {
+      output_path = argument;
+      continue;
+    } else if (option == "--sweep") {
+      sweep_type = argument;
+      if (sweep_type != "grid" && sweep_type != "lhs") {
+        std::cerr << "--sweep expects grid or lhs, got '" << argument << "'\n";
+        return 1;
+      }
+      continue;
+    }
+
+    size_t value;
+    if (!ParseSize(argument, value)) {
+      std::cerr << option << " expects a non-negative integer, got '" << argument << "'\n";
+      return 1;
+    }
+
+    if (option == "--ticks") {
+      num_of_ticks = value;
+    } else if (option == "--population") {
+      disease.SetSusceptiblePopulationSize(value);
+    } else if (option == "--seed") {
+      disease.SetSeed(value);
+    } else if (option == "--world-width" || option == "--world-height" ||
+               option == "--particle-radius") {
+      if (value == 0) {
+        std::cerr << option << " must be greater than 0\n";
+        return 1;
+      }
+
+      if (option == "--world-width") {
+        world_size.x = float(value);
+      } else if (option == "--world-height") {
+        world_size.y = float(value);
+      } else {
+        disease.SetParticleRadius(double(value));
+      }
+    } else if (option == "--replicates") {
+      num_of_replicates = value;
+    } else if (option == "--replicate-threads") {
+      num_of_replicate_threads = value;
+    } else if (option == "--samples") {
+      num_of_samples = value;
+    } else if (option == "--sweep-threads") {
+      num_of_sweep_threads = value;
+    } else if (option == "--threads") {
+      disease.SetNumOfThreads(value);
+    } else if (option == "--reorder-interval") {
+      disease.SetReorderInterval(value);
+    } else if (option == "--exposure-time") {
+      if (!IsWithinRange(option, value, disease.GetMinimumExposureTime(),
+                         disease.GetMaximumExposureTime())) {
+        return 1;
+      }
+      disease.SetExposureTime(value);
+    } else if (option == "--infected-time") {
+      if (!IsWithinRange(option, value, disease.GetMinimumInfectedTime(),
+                         disease.GetMaximumInfectedTime())) {
+        return 1;
+      }
+      disease.SetInfectedTime(value);
+    } else if (option == "--social-distance") {
+      if (!IsWithinRange(option, value, disease.GetMinimumSocialDistancePercentage(),
+                         disease.GetMaximumSocialDistancePercentage())) {
+        return 1;
+      }
+      disease.SetPercentPerformingSocialDistance(value);
+    } else if (option == "--infection-radius") {
+      if (!IsWithinRange(option, value, disease.GetMinimumInfectionRadius(),
+                         disease.GetMaximumInfectionRadius())) {
+        return 1;
+      }
+      disease.SetRadiusOfInfection(value);
+    } else {
+      std::cerr << "Unknown option " << option << "\n";
+      PrintUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  // Same rule the simulator and sweeps follow while anyone is social distancing
+  size_t minimum_allowed_radius =
+      disease.GetMinimumAllowedRadius(disease.GetPercentPerformingSocialDistance());
+  if (disease.GetRadiusOfInfection() < minimum_allowed_radius) {
+    std::cerr << "--infection-radius must be at least " << minimum_allowed_radius
+              << " when anyone is social distancing\n";
+    return 1;
+  }
+  if (should_profile && (num_of_replicates != 0 || !sweep_type.empty())) {
+    std::cerr << "--profile can't be used with --replicates or --sweep\n";
+    return 1;
+  }
+  if (num_of_replicates != 0 && !sweep_type.empty()) {
+    std::cerr << "--replicates can't be used with --sweep\n";
+    return 1;
+  }
+
+  runner.SetWorldSize(world_size.x, world_size.y);
+
+  std::ofstream output_file;
+  if (!output_path.empty()) {
+    output_file.open(output_path);
+    if (!output_file) {
+      std::cerr << "Couldn't open " << output_path << " for writing\n";
+      return 1;
+    }
+  }
+  std::ostream& output = output_path.empty() ? std::cout : output_file;
+
+  if (!sweep_type.empty()) {
+    ParameterSweep sweep(disease);
+    sweep.SetNumOfThreads(num_of_sweep_threads);
+
+    vector<FeatureSettings> settings;
+    if (sweep_type == "grid") {
+      settings = sweep.GetGrid();
+    } else {
+      settings = sweep.GetLatinHypercube(num_of_samples, disease.GetSeed());
+    }
+    sweep.Write(settings, sweep.Run(settings, num_of_ticks), output);
+  } else if (num_of_replicates == 0) {
+    runner.Run(num_of_ticks, output);
+  } else {
+    Ensemble ensemble(disease);
+    ensemble.SetNumOfThreads(num_of_replicate_threads);
+    ensemble.Run(num_of_replicates, num_of_ticks);
+    ensemble.Write(output);
+
+    std::cerr << "peak infectious: mean " << ensemble.GetPeakInfectious().GetMean()
+              << ", 90% of runs between " << ensemble.GetPeakInfectious().GetQuantile(0.05)
+              << " and " << ensemble.GetPeakInfectious().GetQuantile(0.95) << "\n"
+              << "time to peak: mean " << ensemble.GetTimeToPeak().GetMean()
+              << ", 90% of runs between " << ensemble.GetTimeToPeak().GetQuantile(0.05)
+              << " and " << ensemble.GetTimeToPeak().GetQuantile(0.95) << " ticks\n";
+  }
+
+  if (should_profile) {
+    runner.WriteProfile(std::cerr);
+  }
+
+  return 0;
+}
@@ -0,0 +1,202 @@
+#include <core/allocation_counter.h>
+#include <core/batch_runner.h>
+#include <core/histogram.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+
+using disease::BatchRunner;
+using disease::Disease;
+using disease::Histogram;
+using disease::Status;
+using disease::StatusCounts;
+
+namespace {
+
+// The simulator's default population lives in a 550x580 container
+const double kDefaultNumOfPeople = 200;
+const double kDefaultContainerWidth = 550;
+const double kDefaultContainerHeight = 580;
+
+/*
+ * Sets up a disease for the specified number of people, in a container scaled
+ * so that they're as crowded as the simulator's default population.
+ *
+ * @param runner The BatchRunner whose disease to set up
+ * @param num_of_people The total number of people, including patient zero
+ */
+void SetUpPopulation(BatchRunner& runner, size_t num_of_people) {
+  double scale = std::sqrt(num_of_people / kDefaultNumOfPeople);
+  runner.SetWorldSize(kDefaultContainerWidth * scale, kDefaultContainerHeight * scale);
+  runner.GetDisease().SetSusceptiblePopulationSize(num_of_people - 1);
+}
+
+/*
+ * Runs ticks on a created population, so that only UpdateParticles is timed.
+ * Also reports the allocations made per tick, which are only counted in
+ * profiling builds (see core/allocation_counter.h).
+ */
+void RunTicks(benchmark::State& state, BatchRunner& runner) {
+  Disease& disease = runner.GetDisease();
+  disease.CreatePopulation();
+  uint64_t num_of_allocations = 0;
+
+  for (auto _ : state) {
+    uint64_t allocations_before = disease::GetNumOfAllocations();
+    disease.UpdateParticles();
+    num_of_allocations += disease::GetNumOfAllocations() - allocations_before;
+    benchmark::DoNotOptimize(disease.GetStatusCounts());
+  }
+
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(disease.GetPopulationData().Size()));
+  if (disease::TickProfiler::kIsEnabled) {
+    state.counters["allocations_per_tick"] =
+        benchmark::Counter(double(num_of_allocations), benchmark::Counter::kAvgIterations);
+  }
+}
+
+/*
+ * Args: number of people, percent social distancing, quarantine, central location.
+ */
+void BM_UpdateParticles(benchmark::State& state) {
+  BatchRunner runner;
+  SetUpPopulation(runner, size_t(state.range(0)));
+  runner.GetDisease().SetPercentPerformingSocialDistance(size_t(state.range(1)));
+  runner.GetDisease().SetShouldQuarantine(state.range(2) != 0);
+  runner.GetDisease().SetHaveCentralLocation(state.range(3) != 0);
+
+  RunTicks(state, runner);
+}
+
+/*
+ * Args: number of people, number of threads.
+ */
+void BM_UpdateParticlesInTwoPhases(benchmark::State& state) {
+  BatchRunner runner;
+  SetUpPopulation(runner, size_t(state.range(0)));
+  runner.GetDisease().SetShouldUpdateInTwoPhases(true);
+  runner.GetDisease().SetNumOfThreads(size_t(state.range(1)));
+
+  RunTicks(state, runner);
+}
+
+/*
+ * Args: number of people, percent social distancing, single precision.
+ */
+void BM_UpdateParticlesByPrecision(benchmark::State& state) {
+  BatchRunner runner;
+  SetUpPopulation(runner, size_t(state.range(0)));
+  runner.GetDisease().SetPercentPerformingSocialDistance(size_t(state.range(1)));
+  runner.GetDisease().SetPrecision(state.range(2) != 0 ? Disease::Precision::kSingle
+                                                       : Disease::Precision::kDouble);
+
+  RunTicks(state, runner);
+}
+
+/*
+ * Args: number of people, percent social distancing, ticks between reorders
+ * (0 to never reorder).
+ */
+void BM_UpdateParticlesReordered(benchmark::State& state) {
+  BatchRunner runner;
+  SetUpPopulation(runner, size_t(state.range(0)));
+  runner.GetDisease().SetPercentPerformingSocialDistance(size_t(state.range(1)));
+  runner.GetDisease().SetReorderInterval(size_t(state.range(2)));
+
+  RunTicks(state, runner);
+}
+
+/*
+ * Args: number of people.
+ */
+void BM_CreatePopulation(benchmark::State& state) {
+  std::unique_ptr<BatchRunner> runner;
+
+  for (auto _ : state) {
+    // Freeing the last population isn't timed
+    state.PauseTiming();
+    runner.reset(new BatchRunner());
+    SetUpPopulation(*runner, size_t(state.range(0)));
+    state.ResumeTiming();
+
+    runner->GetDisease().CreatePopulation();
+  }
+
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+/*
+ * Args: number of ticks already in the histogram.
+ */
+void BM_HistogramUpdate(benchmark::State& state) {
+  StatusCounts status_counts;
+  status_counts[Status::kSusceptible] = 150;
+  status_counts[Status::kSymptomatic] = 40;
+  status_counts[Status::kAsymptomatic] = 10;
+  status_counts[Status::kRemoved] = 1;
+
+  Histogram histogram;
+  size_t time_passed = 0;
+  while (time_passed < size_t(state.range(0))) {
+    histogram.Update(status_counts, ++time_passed);
+  }
+
+  for (auto _ : state) {
+    histogram.Update(status_counts, ++time_passed);
+    benchmark::DoNotOptimize(histogram.GetBins().back());
+  }
+}
+
+void PopulationSizes(benchmark::internal::Benchmark* benchmark) {
+  for (int64_t num_of_people : {200, 2000, 20000, 200000}) {
+    benchmark->Args({num_of_people});
+  }
+}
+
+void FeatureToggles(benchmark::internal::Benchmark* benchmark) {
+  // Each feature on its own, then everything on at once
+  const int64_t kFeatures[][3] = {{0, 0, 0}, {50, 0, 0}, {100, 0, 0},
+                                  {0, 1, 0}, {0, 0, 1}, {100, 1, 1}};
+
+  for (int64_t num_of_people : {200, 2000, 20000, 200000}) {
+    for (const auto& features : kFeatures) {
+      benchmark->Args({num_of_people, features[0], features[1], features[2]});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_UpdateParticles)
+    ->ArgNames({"people", "social_distance", "quarantine", "central_location"})
+    ->Apply(FeatureToggles)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_UpdateParticlesInTwoPhases)
+    ->ArgNames({"people", "threads"})
+    ->ArgsProduct({{20000, 200000}, {1, 2, 4, 8}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+BENCHMARK(BM_UpdateParticlesByPrecision)
+    ->ArgNames({"people", "social_distance", "single"})
+    ->ArgsProduct({{20000, 200000}, {0, 100}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_UpdateParticlesReordered)
+    ->ArgNames({"people", "social_distance", "reorder_interval"})
+    ->ArgsProduct({{20000, 200000}, {0, 100}, {0, 1, 4}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_CreatePopulation)
+    ->ArgNames({"people"})
+    ->Apply(PopulationSizes)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_HistogramUpdate)
+    ->ArgNames({"ticks"})
+    ->Arg(0)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
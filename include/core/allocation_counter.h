@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace disease {
+
+/*
+ * Gets the number of calls the program has made to the global allocator
+ * (operator new, by any thread) so far, so tests and the tick profiler can
+ * check that steady-state ticks don't allocate.
+ *
+ * Allocations are only counted in programs linked with the counting operator
+ * new (src/core/counting_allocator.cc, the disease_counting_allocator target),
+ * which are the tests, and everything when DISEASE_ENABLE_PROFILING is on.
+ * Otherwise the count stays 0.
+ *
+ * @return The number of allocations made
+ */
+uint64_t GetNumOfAllocations();
+
+/*
+ * Adds an allocation to the count. Called by the counting operator new.
+ */
+void CountAllocation();
+
+}  // namespace disease
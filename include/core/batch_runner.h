@@ -0,0 +1,81 @@
+#pragma once
+
+#include "core/infectious_disease.h"
+#include <ostream>
+
+namespace disease {
+
+/*
+ * Runs a Disease without a window, as fast as it can be updated, and writes
+ * the number of people with each health status after every tick.
+ *
+ * The container, quarantine box, and central location are laid out the same
+ * way as in the Cinder app/simulator, so a batch run behaves like a run of
+ * the simulator with the same features.
+ */
+class BatchRunner {
+ public:
+  BatchRunner();
+
+  /*
+   * Gives access to the disease being run, so its features (i.e. the same
+   * ones the simulator can change) and population size can be set before
+   * the run.
+   *
+   * @return The Disease to run
+   */
+  Disease& GetDisease();
+
+  /*
+   * Resizes the container, and lays out the quarantine box and central
+   * location around it the same way the simulator does, scaled with the
+   * container. Meant for running populations much larger than the simulator
+   * fits, at the same density.
+   *
+   * @param container_width The distance between the container's left and right walls
+   * @param container_height The distance between the container's top and bottom walls
+   */
+  void SetWorldSize(double container_width, double container_height);
+
+  /*
+   * Creates the population and updates it for the specified number of ticks.
+   * The counts are written as CSV, with a header row followed by one row for
+   * the population before the first tick and one row after every tick.
+   *
+   * @param num_of_ticks The number of times to update the population
+   * @param output The stream to write the counts to
+   */
+  void Run(size_t num_of_ticks, std::ostream& output);
+
+  /*
+   * Writes how long each phase of a tick took on average over the last run,
+   * along with the average pair tests and allocations per tick. Empty unless
+   * DISEASE_ENABLE_PROFILING is defined.
+   *
+   * @param output The stream to write the profile to
+   */
+  void WriteProfile(std::ostream& output) const;
+
+ private:
+  // Same layout as the Cinder app/simulator
+  constexpr static double kTopContainerMargin = 50;
+  constexpr static double kLeftContainerMargin = 25;
+  constexpr static double kContainerHeight = 580;
+  constexpr static double kContainerWidth = 550;
+  constexpr static double kSpacesFromContainer = 20;  // between the container and quarantine box
+  constexpr static double kQuarantineBoxWidth = 675;
+  constexpr static double kQuarantineBoxHeight = 230;  // aligned with the container's bottom
+  constexpr static double kLocationDimension = 100;
+
+  Disease disease_;
+
+  /*
+   * Writes a row with the number of people with each health status.
+   *
+   * @param tick The number of ticks run so far
+   * @param output The stream to write the row to
+   */
+  void WriteStatusCounts(size_t tick, std::ostream& output) const;
+};
+
+}  // namespace disease
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace disease {
+
+/*
+ * The instruction sets the distance kernel can run on, slowest first.
+ */
+enum class SimdLevel {
+  kScalar,
+  kAvx2,
+  kAvx512,
+};
+
+/*
+ * The most candidates FindWithinDistance compares at once.
+ */
+const size_t kDistanceBatchSize = 16;
+
+/*
+ * Gets the fastest instruction set both the build and the CPU running it
+ * support. Checked once, the first time it's called.
+ *
+ * @return The SimdLevel FindWithinDistance runs on
+ */
+SimdLevel GetSimdLevel();
+
+/*
+ * Finds which candidates are close enough to a point, i.e. the distance
+ * between their centers is at most the point's reach plus the candidate's
+ * radius. Squared distances are compared against squared thresholds, so no
+ * square roots are taken. Every SimdLevel gives exactly the same result.
+ *
+ * @param position_x The x value of the point's position
+ * @param position_y The y value of the point's position
+ * @param reach The point's radius plus the extra distance being tested for
+ *     (e.g. the radius of infection)
+ * @param candidates_x The x values of the candidates' positions
+ * @param candidates_y The y values of the candidates' positions
+ * @param candidate_radii The radii of the candidates
+ * @param num_of_candidates The number of candidates, at most kDistanceBatchSize
+ * @return A bitmask where bit i is set if candidate i is close enough
+ */
+uint32_t FindWithinDistance(float position_x, float position_y, double reach,
+                            const float* candidates_x, const float* candidates_y,
+                            const double* candidate_radii, size_t num_of_candidates);
+
+/*
+ * Same as above, but on the specified instruction set (which has to be
+ * supported; see GetSimdLevel).
+ */
+uint32_t FindWithinDistance(SimdLevel level, float position_x, float position_y, double reach,
+                            const float* candidates_x, const float* candidates_y,
+                            const double* candidate_radii, size_t num_of_candidates);
+
+/*
+ * Checks if a single pair is close enough, the same way as FindWithinDistance.
+ */
+inline bool IsWithinDistance(float position_x, float position_y, double reach,
+                             float other_x, float other_y, double other_radius) {
+  double difference_x = float(position_x - other_x);
+  double difference_y = float(position_y - other_y);
+  double threshold = reach + other_radius;
+  return difference_x * difference_x + difference_y * difference_y <= threshold * threshold;
+}
+
+/*
+ * Same as FindWithinDistance, but the squared distances and thresholds are
+ * computed in single precision, so twice as many candidates fit in a vector
+ * and the radii take half the memory. Every SimdLevel gives exactly the same
+ * result, which may differ from the double precision result for candidates
+ * right at the edge of the reach.
+ */
+uint32_t FindWithinDistanceSingle(float position_x, float position_y, float reach,
+                                  const float* candidates_x, const float* candidates_y,
+                                  const float* candidate_radii, size_t num_of_candidates);
+
+/*
+ * Same as above, but on the specified instruction set (which has to be
+ * supported; see GetSimdLevel).
+ */
+uint32_t FindWithinDistanceSingle(SimdLevel level, float position_x, float position_y, float reach,
+                                  const float* candidates_x, const float* candidates_y,
+                                  const float* candidate_radii, size_t num_of_candidates);
+
+/*
+ * Checks if a single pair is close enough, the same way as
+ * FindWithinDistanceSingle.
+ */
+inline bool IsWithinDistanceSingle(float position_x, float position_y, float reach,
+                                   float other_x, float other_y, float other_radius) {
+  float difference_x = position_x - other_x;
+  float difference_y = position_y - other_y;
+  float threshold = reach + other_radius;
+  return difference_x * difference_x + difference_y * difference_y <= threshold * threshold;
+}
+
+}  // namespace disease
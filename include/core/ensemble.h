@@ -0,0 +1,111 @@
+#pragma once
+
+#include "core/infectious_disease.h"
+#include "core/running_statistics.h"
+#include <mutex>
+#include <ostream>
+
+namespace disease {
+
+/*
+ * Summarizes the number of people with each health status at one tick, over
+ * every run of an ensemble.
+ */
+struct TickStatistics {
+    RunningStatistics statistics[StatusCounts::kNumOfStatuses];
+
+    RunningStatistics& operator[](Status status);
+    const RunningStatistics& operator[](Status status) const;
+};
+
+/*
+ * Runs many independent copies (replicates) of a Disease, each with its own
+ * seed, on a pool of threads, and summarizes how the outbreak went across
+ * them: the number of people with each status at every tick, and each run's
+ * peak number of infectious people and the tick it happened at.
+ *
+ * Each run's counts are added to the summaries as soon as it finishes, so the
+ * memory used doesn't grow with the number of replicates. The summaries don't
+ * depend on the order the runs finish in, so the same disease, seed, and
+ * number of replicates always gives the same results on any number of threads.
+ */
+class Ensemble {
+ public:
+  /*
+   * @param disease The disease to copy for each replicate, with its features,
+   *     population size, and container already set; its seed is used to
+   *     derive each replicate's seed and its population is recreated
+   */
+  explicit Ensemble(const Disease& disease);
+
+  /*
+   * Sets the number of replicates run at the same time. Each replicate is
+   * updated on a single thread.
+   *
+   * @param num_of_threads The number of threads to run replicates on
+   */
+  void SetNumOfThreads(size_t num_of_threads);
+  size_t GetNumOfThreads() const;
+
+  /*
+   * Runs the replicates, replacing the results of any earlier run.
+   *
+   * @param num_of_replicates The number of independent runs
+   * @param num_of_ticks The number of ticks to update each run for
+   */
+  void Run(size_t num_of_replicates, size_t num_of_ticks);
+
+  /*
+   * Writes the summary of every tick as CSV, with a header row followed by
+   * one row per tick (starting with the population before the first tick).
+   * Each status has its mean, standard deviation, and 5th, 50th, and 95th
+   * percentiles.
+   *
+   * @param output The stream to write the summaries to
+   */
+  void Write(std::ostream& output) const;
+
+  /*
+   * Derives the seed of a replicate, so that every replicate's random values
+   * are independent of the others'.
+   *
+   * @param base_seed The seed of the disease the ensemble copies
+   * @param replicate The index of the replicate
+   * @return The replicate's seed
+   */
+  static uint64_t GetReplicateSeed(uint64_t base_seed, size_t replicate);
+
+  size_t GetNumOfReplicates() const;
+  const vector<TickStatistics>& GetTickStatistics() const;  // indexed by tick
+  const RunningStatistics& GetPeakInfectious() const;
+  const RunningStatistics& GetTimeToPeak() const;  // in ticks
+
+ private:
+  Disease disease_;
+  size_t num_of_threads_;
+
+  // Guards the results while replicates are running
+  std::mutex results_mutex_;
+  size_t num_of_replicates_;
+  vector<TickStatistics> tick_statistics_;
+  RunningStatistics peak_infectious_;
+  RunningStatistics time_to_peak_;
+
+  /*
+   * Runs a single replicate and stores the status counts after every tick.
+   *
+   * @param replicate The index of the replicate
+   * @param status_counts Where to store the counts (one per tick, plus the
+   *     population before the first tick)
+   */
+  void RunReplicate(size_t replicate, vector<StatusCounts>& status_counts) const;
+
+  /*
+   * Adds a finished replicate's counts to the summaries.
+   *
+   * @param status_counts The counts of every tick of the replicate
+   */
+  void AddReplicate(const vector<StatusCounts>& status_counts);
+};
+
+}  // namespace disease
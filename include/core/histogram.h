@@ -4,144 +4,110 @@
 #pragma once
 
 #include "core/infectious_disease.h"
-#include <map>
-
-using std::map;
 
 namespace disease {
 
 /*
- * Holds functionality for generating the histograms that
- * are to be displayed in Cinder app/simulator.
+ * The status counts of consecutive frames added together, so a long outbreak
+ * can be drawn with a bounded number of bins.
+ */
+struct HistogramBin {
+    StatusCounts total_counts;  // summed over the frames in the bin
+    size_t num_of_frames = 0;
+
+    /*
+     * Gets the average number of people with a health status over the
+     * frames in the bin.
+     *
+     * @param status The health status to average
+     * @return A double of the average, or 0 if the bin has no frames
+     */
+    double GetAverage(Status status) const;
+};
+
+/*
+ * Keeps track of the health status of the population over time, which is
+ * what the histogram displayed in the Cinder app/simulator is drawn from
+ * (see visualizer/histogram_drawer.h). Only the number of people with each
+ * status is kept, not the people themselves.
  */
 class Histogram {
  private:
-  const size_t kNumOfStatuses = 4;
-
-  // ================================
-  // Constants for drawing histograms
-  // ================================
-  const double kHistogramGraphDimension = 300;  // length and width of histogram graph
-  const size_t kLabelSpacingFromHistogram = 10;
-  const size_t kLabelSpacingFromHistogramTimes2 = 20;
-  const size_t kSpacingFromContainer = 125;
-
   double upper_bound_for_y_;  // i.e. the highest label value for y axis
-  vec2 container_top_right_corner_;
   double time_elapsed_since_outbreak_;
 
-  // Info regarding placement of histogram stuff
-  size_t bottom_most_boundary_of_histogram_;
-  size_t x_coordinate_of_status_stat_labels_;
-
-  // the key is a Status representing the health status
-  // the value is a vector representing the people with the specified health status
-  map<Status, vector<Disease::Person>> population_sorted_by_status_;
+  // The number of people with each health status in the current frame
+  StatusCounts status_counts_;
 
-  // Contains info of sorted particles for every frame
-  vector<map<Status, vector<Disease::Person>>> cumulative_info_of_population_;
+  // The status counts for every frame since the outbreak started, downsampled:
+  // once there are kMaximumNumOfBins bins, neighboring bins are merged and
+  // each bin holds twice as many frames
+  vector<HistogramBin> bins_;
+  size_t frames_per_bin_;
+  size_t bin_layout_version_;  // changes when existing bins are merged or removed
 
   /*
-   * Draws the background of the histogram (i.e. the graph).
+   * Adds a frame's status counts to the last bin, starting a new bin (and
+   * merging bins if there's no room) once the last one is full.
    *
-   * @param left_boundary_of_histogram The left boundary of the histogram
-   * @param top_left_corner_y The y value of the top left corner of the histogram
-   * @return A vector holding the vec2 values of the top left and bottom right
-   *     corners of the histogram, in that order
+   * @param status_counts The number of people with each health status
    */
-  vector<vec2> DrawHistogramBackground(double left_boundary_of_histogram,
-                                       double histogram_top_left_corner_y) const;
+  void AddToBins(const StatusCounts& status_counts);
 
   /*
-   * Draws the bins of the histogram.
-   *
-   * @param left_boundary_of_histogram The left boundary of the histogram
-   * @param top_left_corner_y The y value of the top left corner of the histogram
+   * Merges each pair of neighboring bins, halving the number of bins.
    */
-  void DrawHistogramBins(double left_boundary_of_histogram,
-                         double histogram_top_left_corner_y) const;
+  void MergeBins();
 
-  /*
-   * Draws a bin for a specific health status.
-   *
-   * @param bin_top_left_x A double of the x coordinate of the top left corner
-   *     of the bin
-   * @param bin_top_left_y A double of the y coordinate of the top left corner
-   *     of the bin
-   * @param bin_bottom_right_x A double of the x coordinate of the bottom
-   *     right corner of the bin
-   * @param bin_bottom_right_y A double of the y coordinate of the bottom
-   *     right corner of the bin
-   * @param color A vec3 of the color of the health status
-   */
-  void DrawStatusBin(double bin_top_left_x, double bin_top_left_y,
-                     double bin_bottom_right_x, double bin_bottom_right_y,
-                     const vec3& color) const;
+ public:
+  // About twice the width of the histogram in pixels, so that merging bins
+  // never leaves fewer bins than pixels to draw them in
+  const static size_t kMaximumNumOfBins = 600;
 
-  /*
-   * Draws the labels of the histogram for the axes and title.
-   *
-   * @param left_boundary_of_histogram The left boundary of the histogram
-   * @param top_left_corner_y The y value of the top left corner of the histogram
-   */
-  void DrawHistogramLabels(double left_boundary_of_histogram,
-                           double histogram_top_left_corner_y) const;
+  Histogram();
+  Histogram(const vector<Disease::Person>& people);
 
-  /*
-   * Draws the axes labels of the histogram.
-   *
-   * @param left_boundary_of_histogram The left boundary of the histogram
-   * @param top_left_corner_y The y value of the top left corner of the histogram
-   */
-  void DrawAxesLabels(double left_boundary_of_histogram,
-                      double histogram_top_left_corner_y) const;
+  const StatusCounts& GetStatusCounts() const;
+  double GetTimeElapsedSinceOutbreak() const;
+  double GetUpperBoundForY() const;
+  const vector<HistogramBin>& GetBins() const;
+  size_t GetFramesPerBin() const;
 
   /*
-   * Draws the labels of the axes bounds.
+   * Gets a number that changes whenever bins are merged or removed, rather
+   * than only added to. Anything built from the bins (e.g. the vertices
+   * drawn for them) only needs to be rebuilt when this changes; otherwise
+   * only bins past the ones already built are new, plus the last bin may
+   * have gained frames.
    *
-   * @param left_boundary_of_histogram The left boundary of the histogram
-   * @param top_left_corner_y The y value of the top left corner of the histogram
+   * @return The version of the bins' layout
    */
-  void DrawBoundsLabels(double left_boundary_of_histogram,
-                        double histogram_top_left_corner_y) const;
+  size_t GetBinLayoutVersion() const;
 
   /*
-   * Draws the status statistics of the population.
+   * Counts the people with each health status.
+   *
+   * @param population The vector of people to count
    */
-  void DrawStatusStatistics() const;
-
- public:
-  Histogram() = default;
-  Histogram(const vector<Disease::Person>& people,
-            const vec2& container_top_right_corner);
-
-  const map<Status, vector<Disease::Person>>& GetSortedPopulation() const;
-  const vector<map<Status, vector<Disease::Person>>>& GetCumulativeInfoOfPopulation() const;
-  double GetTimeElapsedSinceOutbreak() const;
-  size_t GetBottomMostBoundaryOfHistogram() const;  // i.e. y coordinate below the x axis label
-  size_t GetXCoordinateOfStatusStatLabels() const;
-  size_t GetYCoordinateOfLastStatusStatLabel() const;
+  void CountPopulation(const vector<Disease::Person>& population);
 
   /*
-   * Sorts all the people according to their health status.
+   * Updates the status counts of the population and the time passed.
    *
-   * @param particles The vector of people to sort
+   * @param status_counts The number of people with each health status (e.g.
+   *     from Disease::GetStatusCounts)
+   * @param time_passed The time elapsed since outbreak started
    */
-  void SortPopulation(const vector<Disease::Person>& population);
+  void Update(const StatusCounts& status_counts, size_t time_passed);
 
   /*
-   * Updates the information of everyone in the population and
-   * of the time passed.
+   * Counts the updated population, then updates the status counts of the
+   * population and the time passed.
    *
    * @param updated_population The updated population
    * @param time_passed The time elapsed since outbreak started
    */
   void Update(const vector<Disease::Person>& updated_population, size_t time_passed);
-
-  /*
-   * Draws the histogram.
-   */
-  void DrawHistogram() const;
 };
 
-}  // namespace disease
\ No newline at end of file
+}  // namespace disease
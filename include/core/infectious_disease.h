@@ -1,29 +1,25 @@
 #pragma once
 
-#include "cinder/gl/gl.h"
-#include "cinder/Rand.h"
+#include "core/distance_kernel.h"
+#include "core/population.h"
+#include "core/random.h"
+#include "core/spatial_grid.h"
+#include "core/status_transitions.h"
+#include "core/thread_pool.h"
+#include "core/tick_profiler.h"
+#include <algorithm>
 #include <cmath>
+#include <memory>
 #include <string>
 #include <vector>
 
 using glm::vec2;
 using glm::vec3;
-using std::map;
 using std::string;
 using std::vector;
 
 namespace disease {
 
-/*
- * Represents the health status of a person.
- */
-enum class Status {
-  kSusceptible,
-  kSymptomatic,  // person is infectious with this status
-  kAsymptomatic,  // person is infectious with this status
-  kRemoved,
-};
-
 /*
  * Holds info on people in the population and their changes
  * in health status and movement.
@@ -31,43 +27,9 @@ enum class Status {
 class Disease {
  public:
   /*
-   * Holds the info pertaining to a single person in the population.
-   *
-   * radius: the radius of the particle representing the person
-   * position: the position of the particle representing the person
-   * velocity: the velocity of the particle representing the person
-   * status: the health status of the person
-   * color: the color of the particle representing the person
-   * continuous_exposure_time: the time the person has been exposed to an
-   *     infected person continuously (used when status is susceptible)
-   * time_infected: the total amount of time the person has been infected
-   *     (used when status is infectious)
-   * has_been_exposed_in_frame: represents if the person (if status is
-   *     susceptible) has been exposed to an infected person within the
-   *     current frame
-   * is_quarantined: represents if the person is in quarantine
-   * is_social_distancing: represents if the person is social distancing
-   * positions_of_people_in_bubble: stores the count of people within social
-   *     distancing bubble (i.e. above, below, right, left)
-   * is_going_to_central_location: represents if the person is going to the
-   *     central location
-   * at_central_location: represents if the person is at the central location
-   */
-  struct Person {
-      double radius;
-      vec2 position;
-      vec2 velocity;
-      Status status;
-      vec3 color;
-      size_t continuous_exposure_time;
-      size_t time_infected;
-      bool has_been_exposed_in_frame;
-      bool is_quarantined;
-      bool is_social_distancing;
-      map<string, size_t> positions_of_people_in_bubble;
-      bool is_going_to_central_location;
-      bool is_at_central_location;
-  };
+   * The info of a single person (see core/population.h).
+   */
+  using Person = disease::Person;
 
   Disease() = default;
   Disease(double left_margin, double top_margin,
@@ -90,14 +52,164 @@ class Disease {
   void SetPercentPerformingSocialDistance(size_t percent_performing_social_distance);
   void SetRadiusOfInfection(size_t radius_of_infection);
   void SetHaveCentralLocation(bool have_central_location);
+  void SetSusceptiblePopulationSize(size_t susceptible_population_size);
+  void SetParticleRadius(double particle_radius);
+  void SetSeed(uint64_t seed);
+
+  /*
+   * Moves the walls of the container people are created in and move around
+   * in. Like the population size and particle radius, this should be set
+   * before the population is created.
+   *
+   * @param left_margin The x value of the left wall
+   * @param top_margin The y value of the top wall
+   * @param container_height The distance between the top and bottom walls
+   * @param container_width The distance between the left and right walls
+   */
+  void SetContainerBounds(double left_margin, double top_margin,
+                          double container_height, double container_width);
+
+  /*
+   * Moves the walls of the quarantine box.
+   *
+   * @param quarantine_top_left The top left corner of the quarantine box
+   * @param quarantine_bottom_right The bottom right corner of the quarantine box
+   */
+  void SetQuarantineBounds(const vec2& quarantine_top_left, const vec2& quarantine_bottom_right);
+
+  /*
+   * Moves the walls of the central location.
+   *
+   * @param location_top_left The top left corner of the central location
+   * @param location_bottom_right The bottom right corner of the central location
+   */
+  void SetLocationBounds(const vec2& location_top_left, const vec2& location_bottom_right);
+
+  /*
+   * Switches between the two ways of updating the population.
+   *
+   * Serially (the default), people are updated one at a time in population
+   * order, and each person sees the changes made to the people before them.
+   *
+   * In two phases, everyone's exposures and social distancing bubbles are
+   * first found from where everyone was at the start of the tick, and then
+   * everyone is updated from those. Each person's update only depends on the
+   * start of the tick, so both phases can be split across threads and the
+   * results are the same no matter how many threads are used.
+   *
+   * @param should_update_in_two_phases A bool representing if the population
+   *     should be updated in two phases
+   */
+  void SetShouldUpdateInTwoPhases(bool should_update_in_two_phases);
+
+  /*
+   * Sets the number of threads the phases are run on when updating in two
+   * phases (serial updates always run on the calling thread).
+   *
+   * @param num_of_threads The number of threads, including the calling thread
+   */
+  void SetNumOfThreads(size_t num_of_threads);
+
+  /*
+   * The floating point type the distance checks (infection and social
+   * distancing) are computed in. Single precision compares twice as many
+   * people per instruction, but people right at the edge of a radius may be
+   * counted differently, so runs aren't identical to double precision ones
+   * (the epidemics are statistically the same; see tests/test_precision.cc).
+   */
+  enum class Precision {
+    kDouble,
+    kSingle,
+  };
 
-  const vector<Person>& GetPopulation();
+  /*
+   * Sets the precision the distance checks are computed in (double by default).
+   *
+   * @param precision The floating point type to compare distances in
+   */
+  void SetPrecision(Precision precision);
+
+  /*
+   * Sets how often the population is sorted by where people are (along a
+   * Morton curve), so that people near each other are also near each other
+   * in memory and the distance checks read fewer cache lines. People keep
+   * their ids and random streams when they're moved (see Population), and
+   * GetPopulation stays in id order.
+   *
+   * Two phase updates give the same results however the population is
+   * ordered. Serial updates go through the population in order, so sorting
+   * changes whose changes each person sees within a tick.
+   *
+   * @param reorder_interval The number of ticks between sorts, or 0 (the
+   *     default) to keep the order people were added in
+   */
+  void SetReorderInterval(size_t reorder_interval);
+
+  /*
+   * Gathers everyone's info into a vector, in the order they were added
+   * (i.e. indexed by id, however the population has been reordered).
+   *
+   * @return A vector of everyone's info
+   */
+  vector<Person> GetPopulation() const;
+
+  /*
+   * Gets the info of one person by their id (the index they were created at),
+   * wherever the population has moved them to (see SetReorderInterval).
+   *
+   * @param person_id The id of the person
+   * @return A copy of the person's info
+   */
+  Person GetPersonById(uint32_t person_id) const;
+
+  /*
+   * Gets where the person with the specified id is currently stored, i.e.
+   * their index in GetPopulationData.
+   *
+   * @param person_id The id of the person
+   * @return The index of the person in the population
+   */
+  size_t GetIndexOfId(uint32_t person_id) const;
+  const Population& GetPopulationData() const;
+
+  /*
+   * Gets the number of people with each health status. The counts are kept up
+   * to date as people change status, so this doesn't go through the population.
+   *
+   * @return The number of people with each health status
+   */
+  const StatusCounts& GetStatusCounts() const;
+
+  /*
+   * Gets the health status changes made by the last call to UpdateParticles,
+   * in population order.
+   *
+   * @return The status changes made in the last tick
+   */
+  const StatusTransitions& GetStatusTransitions() const;
+
+  /*
+   * Gets how long each phase of the recent ticks took. The profile is only
+   * collected when DISEASE_ENABLE_PROFILING is defined.
+   *
+   * @return The profiler timing UpdateParticles
+   */
+  const TickProfiler& GetTickProfiler() const;
   bool GetShouldQuarantineValue() const;
   size_t GetExposureTime() const;
   size_t GetInfectedTime() const;
   size_t GetPercentPerformingSocialDistance() const;
   size_t GetRadiusOfInfection() const;
   bool GetHaveCentralLocation() const;
+  size_t GetSusceptiblePopulationSize() const;
+  double GetParticleRadius() const;
+  vec2 GetContainerTopLeft() const;
+  vec2 GetContainerBottomRight() const;
+  uint64_t GetSeed() const;
+  bool GetShouldUpdateInTwoPhases() const;
+  size_t GetNumOfThreads() const;
+  Precision GetPrecision() const;
+  size_t GetReorderInterval() const;
 
   size_t GetMinimumExposureTime() const;
   size_t GetMaximumExposureTime() const;
@@ -108,6 +220,18 @@ class Disease {
   size_t GetMaximumSocialDistancePercentage() const;
   size_t GetMinimumInfectionRadius() const;
   size_t GetMaximumInfectionRadius() const;
+  size_t GetFeatureIncrement() const;  // i.e. the step between a feature's values
+
+  /*
+   * Gets the smallest radius of infection allowed with the specified amount of
+   * social distancing. While anyone is social distancing, the radius has to
+   * reach past their bubble, so it's at least the amount of social distance
+   * plus one feature increment.
+   *
+   * @param percent_performing_social_distance The percent of people social distancing
+   * @return The smallest radius of infection allowed
+   */
+  size_t GetMinimumAllowedRadius(size_t percent_performing_social_distance) const;
 
   /*
    * Create a population where all but one is susceptible to the disease (the
@@ -145,6 +269,7 @@ class Disease {
   const static size_t kMinimumInfectionRadius = 5;
   const static size_t kMaximumInfectionRadius = 45;
   const static size_t kTimeToBeDetectedForQuarantine = 70;
+  const static size_t kFeatureIncrement = 5;
   constexpr static double kProbabilityOfBeingAsymptomatic = 0.2;
   constexpr static double kProbabilityOfBeingSymptomatic = 0.8;
 
@@ -157,6 +282,8 @@ class Disease {
   size_t percent_performing_social_distance_;
   size_t radius_of_infection_;
   bool have_central_location_;
+  size_t susceptible_population_size_;  // doesn't include patient zero
+  double particle_radius_;
 
   bool is_infection_determination_random_;
   bool is_symptomatic_;
@@ -194,83 +321,203 @@ class Disease {
   /*
    * Holds all the particles, each representing a person.
    */
-  vector<Person> population_;
+  Population population_;
+
+  /*
+   * The random values used to update a person are drawn from that person's own
+   * stream, at the current tick, so they don't depend on the order people are
+   * updated in. Each value drawn for a person within a tick is a different draw.
+   */
+  enum class RandomDraw {
+    kPositionX,
+    kPositionY,
+    kVelocityX,
+    kVelocityY,
+    kInfectionStatus,
+    kLeavingLocation,
+    kGoingToLocation,
+    kLocationPositionX,
+    kLocationPositionY,
+    kQuarantinePositionX,
+    kQuarantinePositionY,
+    kDistancingVelocityX,
+    kDistancingVelocityY,
+  };
+
+  Random random_;
+  size_t num_of_ticks_;  // i.e. the number of times UpdateParticles has been called
+
+  bool should_update_in_two_phases_;
+  Precision precision_;
+  size_t reorder_interval_;
+
+  StatusCounts status_counts_;
+  StatusTransitions status_transitions_;  // changes made in the current tick
+
+  // Shared by copies of this Disease; null when running on the calling thread only
+  std::shared_ptr<ThreadPool> thread_pool_;
+
+  /*
+   * Indexes everyone by where they were at the start of the frame, so the
+   * infection and social distancing checks only look at people in the
+   * neighboring cells. Built once per frame and shared by both checks.
+   */
+  SpatialGrid neighbor_grid_;
+
+  // Buffers used to sort the population by where people are: each person's
+  // Morton code (high bits) and index (low bits), then the sorted indices
+  vector<uint64_t> reorder_keys_;
+  vector<size_t> reorder_order_;
+
+  // Times each phase of a tick; mutable so the const distance checks can be
+  // counted
+  mutable TickProfiler tick_profiler_;
+
+  /*
+   * Makes room in every buffer used to update the population for the
+   * specified number of people, so none of them grow once it's created.
+   *
+   * @param num_of_people The number of people in the population
+   */
+  void ReserveBuffers(size_t num_of_people);
+
+  /*
+   * Sorts the population along a Morton curve over everyone's positions
+   * (see SetReorderInterval).
+   */
+  void ReorderPopulation();
 
   /*
    * Creates a susceptible person with their info initialized.
    *
+   * @param index The index the person will have in the population
    * @return The person with their info initialized as a susceptible person
    */
-  Person CreatePerson();
+  Person CreatePerson(size_t index);
 
   /*
    * Creates a person who is infected.
    *
+   * @param index The index the person will have in the population
    * @return The person with their info initialized as an infected person
    */
-  Person CreatePatientZero();
+  Person CreatePatientZero(size_t index);
 
   /*
-   * Resets each person's has_been_exposed_in_frame status to false and
-   * clears positions_of_people_in_bubble.
+   * Resets each person's has_been_exposed_in_frame status to false,
+   * clears positions_of_people_in_bubble, and rebuilds the neighbor grid.
    */
   void ResetFrame();
 
   /*
-   * Updates the person's status based on the current stats for the person (i.e.
-   * exposure time if currently susceptible or infected time if currently infected).
+   * Counts everyone's health status from scratch (used when the population
+   * is replaced).
+   */
+  void CountStatuses();
+
+  /*
+   * Changes the current person's health status and records the change.
    *
-   * @param current_person The current person's status to update
-   * @param current_index The index of the current person in the population vector
-   * @return The person with their status updated
+   * @param current_index The index of the current person in the population
+   * @param status The new health status of the current person
    */
-  Person UpdatePersonStatus(const Person& current_person, size_t current_index);
+  void ChangeStatus(size_t current_index, Status status);
 
   /*
-   * Updates the exposure time for a susceptible person.
+   * Updates everything about the current person for this tick (i.e. their
+   * health status, central location status, velocity, and position).
    *
-   * @param current_person The current person's exposure time to update
-   * @param current_index The index of the current person in the population vector
-   * @return The person with their exposure time updated
+   * @param current The index of the current person in the population
+   */
+  void UpdatePerson(size_t current);
+
+  /*
+   * Updates the population in two phases (see SetShouldUpdateInTwoPhases).
    */
-  Person UpdateExposureTime(const Person& current_person, size_t current_index);
+  void UpdateParticlesInTwoPhases();
+
+  /*
+   * First phase of a two phase update: finds if the current person has been
+   * exposed to an infected person, and counts the people in their social
+   * distancing bubble, using where everyone was at the start of the tick.
+   * Only writes to the current person's info.
+   *
+   * @param current_index The index of the current person in the population
+   */
+  void FindInteractions(size_t current_index);
+
+  /*
+   * Calls the function with the index of every person in the population,
+   * spread across the thread pool if there is one.
+   *
+   * @param function The function to call with each index
+   */
+  template <typename Function>
+  void ForEachPerson(Function& function) {
+    if (thread_pool_) {
+      thread_pool_->ParallelFor(population_.Size(), function);
+    } else {
+      for (size_t current = 0; current < population_.Size(); current++) {
+        function(current);
+      }
+    }
+  }
+
+  /*
+   * Updates the person's status in place based on the current stats for the person
+   * (i.e. exposure time if currently susceptible or infected time if currently infected).
+   *
+   * @param current_index The index of the current person in the population
+   */
+  void UpdatePersonStatus(size_t current_index);
+
+  /*
+   * Updates the exposure time for a susceptible person in place.
+   *
+   * @param current_index The index of the current person in the population
+   */
+  void UpdateExposureTime(size_t current_index);
 
   /*
    * Checks if the current person is within the radius of infected people.
    *
-   * @param current_person The current person to check
-   * @param current_index The index of the current person in the population vector
+   * @param current_index The index of the current person in the population
    * @return A bool representing if the current person is within the radius
    *     of an infected person
    */
-  bool WithinInfectionRadiusOfOthers(const Person& current_person, size_t current_index) const;
+  bool WithinInfectionRadiusOfOthers(size_t current_index) const;
 
   /*
    * Determines whether the susceptible person becomes an infected person who is now
-   * symptomatic or asymptomatic.
+   * symptomatic or asymptomatic, and gives them that status.
    *
-   * @param current_person The current person to determine the infectious status for
-   * @return The person with the chosen infection status
+   * @param current_index The index of the current person in the population
    */
-  Person DetermineInfectionStatus(const Person& current_person) const;
+  void DetermineInfectionStatus(size_t current_index);
 
   /*
    * Makes the current infected person expose the disease to those who are susceptible.
    *
-   * @param current_person The current person who is infected
-   * @param current_index The index of the current person in the population vector
+   * @param current_index The index of the current person in the population
    */
-  void ExposeOthers(const Person& current_person, size_t current_index);
+  void ExposeOthers(size_t current_index);
 
   /*
-   * Checks if the current person is within the radius of the specified infected person.
+   * Visits everyone in the neighboring cells whose particle is within the
+   * specified distance of the current person's particle (i.e. the gap between
+   * the particles' edges is at most the distance), including the current
+   * person. Candidates are compared in batches with FindWithinDistance, using
+   * where they were when the grid was built. The visitor is called as
+   * visit(other_index) and returns false to stop the search early.
    *
-   * @param current_person The current person to check
-   * @param other_person The person to check if the current person is within their infection radius
-   * @return A bool representing if the current person is within the radius
-   *     of an infected person
+   * @param current_index The index of the current person in the population
+   * @param distance The largest gap between the particles (e.g. the radius of
+   *     infection or the amount of social distance)
+   * @param visit The callable to pass each index within the distance to
+   * @return A bool representing if everyone within the distance was visited
    */
-  bool WithinOneInfectionRadius(const Person& current_person, const Person& other_person) const;
+  template <typename Visitor>
+  bool ForEachWithinDistance(size_t current_index, double distance, Visitor visit) const;
 
   /*
    * Determines if a person is going to, at, or leaving the central location.
@@ -331,7 +578,7 @@ class Disease {
   /*
    * Checks if the current particle has collided with a specific wall.
    *
-   * @param current_particle The current Particle to check for a collision
+   * @param current The index of the current particle to check for a collision
    * @param wall_boundary The wall to check for a collision with
    * @param is_horizontal_wall A bool representing if the wall being checked
    *     is a horizontal wall
@@ -351,7 +598,7 @@ class Disease {
    * @return A bool representing if the current particle has collided with
    *     the wall
    */
-  bool HasCollidedWithWall(const Person& current_particle, double wall_boundary,
+  bool HasCollidedWithWall(size_t current, double wall_boundary,
                            bool is_horizontal_wall, bool is_lower_bound,
                            double perpendicular_lower_bound,
                            double perpendicular_upper_bound,
@@ -360,7 +607,7 @@ class Disease {
   /*
    * Checks if the current particle is moving towards a wall.
    *
-   * @param current_particle The current particle to check
+   * @param current The index of the current particle to check
    * @param wall_position The position of the wall where the current particle
    *      would be touching
    * @param is_horizontal_wall A bool representing if the wall being checked
@@ -381,7 +628,7 @@ class Disease {
    * @return A bool representing if the current particle is moving towards
    *     the wall
    */
-  bool IsMovingTowardsWall(const Person& current_particle, const vec2& wall_position,
+  bool IsMovingTowardsWall(size_t current, const vec2& wall_position,
                            bool is_horizontal, bool is_lower_bound,
                            double perpendicular_lower_bound,
                            double perpendicular_upper_bound, bool is_outside_collision) const;
@@ -389,7 +636,7 @@ class Disease {
   /*
    * Checks if the current particle is moving towards a wall from the outside.
    *
-   * @param current_particle The current particle to check
+   * @param current The index of the current particle to check
    * @param wall_position The position of the wall where the current particle
    *      would be touching
    * @param is_horizontal A bool representing if the wall being checked
@@ -408,7 +655,7 @@ class Disease {
    * @return A bool representing if the current particle is moving towards
    *     the wall
    */
-  bool IsMovingTowardsWallOnOutside(const Person& current_particle,
+  bool IsMovingTowardsWallOnOutside(size_t current,
                                     const vec2& wall_position,
                                     bool is_horizontal, bool is_lower_bound,
                                     double perpendicular_lower_bound,
@@ -417,18 +664,17 @@ class Disease {
   /*
    * Determines if the current person should be quarantined based on their statistics.
    *
-   * @param current_person The current person to check
+   * @param current The index of the current person in the population
    * @return A bool representing if the current person should be quarantined
    */
-  bool ShouldBeQuarantined(const Person& current_person) const;
+  bool ShouldBeQuarantined(size_t current) const;
 
   /*
    * Moves the current person to the quarantine box.
    *
-   * @param current_person The current person to put in quarantine
-   * @return A Person representing the current person with updated info
+   * @param current_index The index of the current person in the population
    */
-  Person QuarantinePerson(const Person& current_person);
+  void QuarantinePerson(size_t current_index);
 
   /*
    * Updates the current person's position.
@@ -445,18 +691,6 @@ class Disease {
    */
   void SocialDistance(size_t current_index);
 
-  /*
-   * Determines whether a person is within the current person's social distancing bubble.
-   *
-   * @param current_person The current Person who is performing social distancing
-   * @param other_person The Person to check
-   * @return A bool representing if the other person is within the current person's social
-   *     distancing bubble
-   */
-  bool WithinDistancingBubble(const Disease::Person& current_person, const Disease::Person& other_person) const;
-
-
-
   /*
    * Saves the other person's position relative to the current person's.
    *
@@ -488,6 +722,47 @@ class Disease {
   vec2 KeepWithinContainer(const vec2& updated_position, double current_particle_radius,
                            double left_bound, double top_bound,
                            double right_bound, double bottom_bound);
+
+  /*
+   * Gets a random float from the specified person's stream at the current
+   * tick. Streams are tied to ids rather than indices, so reordering the
+   * population doesn't change anyone's draws.
+   *
+   * @param id The id of the person (see Population)
+   * @param draw Which of the person's values for this tick to get
+   * @param lower_bound The smallest value that can be returned
+   * @param upper_bound The largest value that can be returned
+   * @return A random float between the bounds
+   */
+  float RandomFloat(uint32_t id, RandomDraw draw, float lower_bound, float upper_bound) const;
 };
 
+template <typename Visitor>
+bool Disease::ForEachWithinDistance(size_t current_index, double distance, Visitor visit) const {
+  float position_x = population_.position_x[current_index];
+  float position_y = population_.position_y[current_index];
+  double reach = population_.radius[current_index] + distance;
+  bool is_single_precision = precision_ == Precision::kSingle;
+
+  return neighbor_grid_.ForEachNeighborRun(vec2(position_x, position_y), [&](const NeighborRun& run) {
+    for (size_t first = 0; first < run.size; first += kDistanceBatchSize) {
+      size_t num_of_candidates = std::min(kDistanceBatchSize, run.size - first);
+      DISEASE_COUNT_PAIR_TESTS(tick_profiler_, num_of_candidates);
+
+      uint32_t hits = is_single_precision
+          ? FindWithinDistanceSingle(position_x, position_y, float(reach), run.positions_x + first,
+                                     run.positions_y + first, run.radii_single + first,
+                                     num_of_candidates)
+          : FindWithinDistance(position_x, position_y, reach, run.positions_x + first,
+                               run.positions_y + first, run.radii + first, num_of_candidates);
+      for (size_t candidate = 0; hits != 0; candidate++, hits >>= 1) {
+        if ((hits & 1) != 0 && !visit(run.indices[first + candidate])) {
+          return false;
+        }
+      }
+    }
+    return true;
+  });
+}
+
 }  // namespace disease
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "core/infectious_disease.h"
+#include <ostream>
+
+namespace disease {
+
+/*
+ * One value for each of the features the simulator lets the user change.
+ */
+struct FeatureSettings {
+    bool should_quarantine = false;
+    size_t exposure_time = 0;
+    size_t infected_time = 0;
+    size_t percent_performing_social_distance = 0;
+    size_t radius_of_infection = 0;
+    bool have_central_location = false;
+
+    /*
+     * Sets the disease's features to these settings.
+     *
+     * @param disease The Disease to change
+     */
+    void ApplyTo(Disease& disease) const;
+};
+
+/*
+ * How one run of a FeatureSettings went.
+ */
+struct SweepResult {
+    StatusCounts final_counts;  // once the run ended
+    size_t peak_infectious = 0;
+    size_t time_to_peak = 0;  // i.e. the first tick with the most infectious people
+    size_t num_of_ticks_run = 0;  // fewer than asked for if nobody was infectious anymore
+};
+
+/*
+ * Runs a Disease once for each of many FeatureSettings, spread across a pool
+ * of threads, and writes how every run went as one table.
+ *
+ * The settings can be every combination of the values the simulator allows
+ * (stepping each feature by the same increment as the simulator's arrow keys)
+ * or a Latin hypercube sample of them. Every run uses the disease's seed, so
+ * differences between rows come from the settings rather than the random
+ * values drawn.
+ */
+class ParameterSweep {
+ public:
+  /*
+   * @param disease The disease to copy for each run, with its population size
+   *     and container already set
+   */
+  explicit ParameterSweep(const Disease& disease);
+
+  /*
+   * Sets the number of runs made at the same time. Each run is updated on a
+   * single thread.
+   *
+   * @param num_of_threads The number of threads to make runs on
+   */
+  void SetNumOfThreads(size_t num_of_threads);
+  size_t GetNumOfThreads() const;
+
+  /*
+   * Gets the values the simulator allows for each numeric feature, from the
+   * minimum to the maximum in steps of the feature increment.
+   *
+   * @param minimum The smallest value
+   * @param maximum The largest value
+   * @return Every value allowed, smallest first
+   */
+  vector<size_t> GetFeatureValues(size_t minimum, size_t maximum) const;
+
+  /*
+   * Gets every combination of the feature values the simulator allows. The
+   * simulator keeps the radius of infection above the social distance when
+   * anyone is social distancing, so combinations where it isn't are left out.
+   *
+   * @return The settings of every combination
+   */
+  vector<FeatureSettings> GetGrid() const;
+
+  /*
+   * Samples the feature values with a Latin hypercube: each feature's range is
+   * split into as many equal strata as there are samples, and every stratum
+   * is used once, in a random order per feature. Radii of infection the
+   * simulator doesn't allow are raised to the smallest allowed value.
+   *
+   * @param num_of_samples The number of settings to sample
+   * @param seed The seed for the strata order and the values within each stratum
+   * @return The sampled settings
+   */
+  vector<FeatureSettings> GetLatinHypercube(size_t num_of_samples, uint64_t seed) const;
+
+  /*
+   * Runs the disease once with each of the settings. A run stops early once
+   * nobody is infectious, since the counts can't change anymore.
+   *
+   * @param settings The settings of each run
+   * @param num_of_ticks The most ticks to update each run for
+   * @return The result of each run, in the same order as the settings
+   */
+  vector<SweepResult> Run(const vector<FeatureSettings>& settings, size_t num_of_ticks) const;
+
+  /*
+   * Writes the settings and results of every run as CSV, with a header row
+   * followed by one row per run.
+   *
+   * @param settings The settings of each run
+   * @param results The result of each run
+   * @param output The stream to write the table to
+   */
+  void Write(const vector<FeatureSettings>& settings, const vector<SweepResult>& results,
+             std::ostream& output) const;
+
+ private:
+  Disease disease_;
+  size_t num_of_threads_;
+
+  /*
+   * Checks if the simulator would allow the settings.
+   *
+   * @param settings The settings to check
+   * @return A bool representing if the radius of infection is allowed
+   */
+  bool IsAllowed(const FeatureSettings& settings) const;
+
+  /*
+   * Runs the disease once with the settings.
+   *
+   * @param settings The settings of the run
+   * @param num_of_ticks The most ticks to update the run for
+   * @return How the run went
+   */
+  SweepResult RunOnce(const FeatureSettings& settings, size_t num_of_ticks) const;
+};
+
+}  // namespace disease
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <vector>
+
+using glm::vec2;
+using glm::vec3;
+using std::vector;
+
+namespace disease {
+
+/*
+ * Represents the health status of a person.
+ */
+enum class Status {
+  kSusceptible,
+  kSymptomatic,  // person is infectious with this status
+  kAsymptomatic,  // person is infectious with this status
+  kRemoved,
+};
+
+/*
+ * Gets the color of the particles representing people with the specified
+ * health status.
+ *
+ * @param status The health status
+ * @return A vec3 of the color of the health status
+ */
+vec3 GetStatusColor(Status status);
+
+/*
+ * Counts the people with each health status. Fixed size, so it can be stored
+ * once per frame without holding on to anyone's info.
+ */
+struct StatusCounts {
+    const static size_t kNumOfStatuses = 4;
+
+    size_t counts[kNumOfStatuses] = {0, 0, 0, 0};
+
+    size_t& operator[](Status status);
+    size_t operator[](Status status) const;
+
+    /*
+     * Gets the number of people who are infectious (i.e. symptomatic or
+     * asymptomatic).
+     *
+     * @return The number of infectious people
+     */
+    size_t GetNumOfInfectious() const;
+
+    /*
+     * Gets the number of people counted with any health status.
+     *
+     * @return The total of every count
+     */
+    size_t GetTotal() const;
+
+    /*
+     * Sets every count to 0.
+     */
+    void Clear();
+};
+
+/*
+ * Represents the directions, relative to a person, that the people in their
+ * social distancing bubble can be in.
+ */
+enum class Direction {
+  kUp,
+  kDown,
+  kLeft,
+  kRight,
+};
+
+/*
+ * Counts the people within a person's social distancing bubble in each
+ * direction. Fixed size, so clearing and copying it never allocates.
+ */
+struct BubbleCounts {
+    const static size_t kNumOfDirections = 4;
+
+    size_t counts[kNumOfDirections] = {0, 0, 0, 0};
+
+    size_t& operator[](Direction direction);
+    size_t operator[](Direction direction) const;
+
+    /*
+     * Checks if nobody has been counted in any direction.
+     *
+     * @return A bool representing if every count is 0
+     */
+    bool IsEmpty() const;
+
+    /*
+     * Sets every count to 0.
+     */
+    void Clear();
+};
+
+/*
+ * Holds the info pertaining to a single person in the population. This is a
+ * copy of one person's info, used to set up and read back the population; the
+ * population itself is stored in a Population.
+ *
+ * radius: the radius of the particle representing the person
+ * position: the position of the particle representing the person
+ * velocity: the velocity of the particle representing the person
+ * status: the health status of the person
+ * color: the color of the particle representing the person
+ * continuous_exposure_time: the time the person has been exposed to an
+ *     infected person continuously (used when status is susceptible)
+ * time_infected: the total amount of time the person has been infected
+ *     (used when status is infectious)
+ * has_been_exposed_in_frame: represents if the person (if status is
+ *     susceptible) has been exposed to an infected person within the
+ *     current frame
+ * is_quarantined: represents if the person is in quarantine
+ * is_social_distancing: represents if the person is social distancing
+ * positions_of_people_in_bubble: stores the count of people within social
+ *     distancing bubble (i.e. above, below, right, left)
+ * is_going_to_central_location: represents if the person is going to the
+ *     central location
+ * at_central_location: represents if the person is at the central location
+ */
+struct Person {
+    double radius;
+    vec2 position;
+    vec2 velocity;
+    Status status;
+    vec3 color;
+    size_t continuous_exposure_time;
+    size_t time_infected;
+    bool has_been_exposed_in_frame;
+    bool is_quarantined;
+    bool is_social_distancing;
+    BubbleCounts positions_of_people_in_bubble;
+    bool is_going_to_central_location;
+    bool is_at_central_location;
+};
+
+/*
+ * Holds the info of everyone in the population as a structure of arrays: each
+ * field of Person has its own contiguous array, and a person is an index into
+ * all of them. The loops over the population mostly read positions,
+ * velocities, and statuses, so those are kept apart from the rest of the info.
+ *
+ * The flags are stored as chars rather than in a vector<bool> so that each
+ * person's flags can be read and written independently of their neighbors'.
+ *
+ * A person's index can change when the population is reordered (see Reorder),
+ * but their id, the index they were added at, stays with them. index_of_id
+ * finds where a person is stored from their id.
+ */
+struct Population {
+    // Read by every distance check and movement update
+    vector<float> position_x;
+    vector<float> position_y;
+    vector<float> velocity_x;
+    vector<float> velocity_y;
+    vector<Status> status;
+
+    // Timers used to update the health status
+    vector<size_t> continuous_exposure_time;
+    vector<size_t> time_infected;
+
+    vector<double> radius;
+    vector<vec3> color;
+    vector<char> has_been_exposed_in_frame;
+    vector<char> is_quarantined;
+    vector<char> is_social_distancing;
+    vector<BubbleCounts> positions_of_people_in_bubble;
+    vector<char> is_going_to_central_location;
+    vector<char> is_at_central_location;
+
+    vector<uint32_t> id;
+    vector<uint32_t> index_of_id;  // i.e. the inverse of id
+
+    size_t Size() const;
+    bool IsEmpty() const;
+
+    /*
+     * Removes everyone from the population.
+     */
+    void Clear();
+
+    /*
+     * Reserves room in every array for the specified number of people.
+     *
+     * @param num_of_people The number of people to make room for
+     */
+    void Reserve(size_t num_of_people);
+
+    /*
+     * Adds a person to the end of the population, with the next id.
+     *
+     * @param person The person to add
+     */
+    void Add(const Person& person);
+
+    /*
+     * Moves everyone to a new index, without allocating.
+     *
+     * @param order The index each person is moved from, indexed by the index
+     *     they're moved to (i.e. a permutation of the indices); it's left as
+     *     0, 1, 2, ... once everyone has been moved
+     */
+    void Reorder(vector<size_t>& order);
+
+    /*
+     * Gathers the info of one person from the arrays.
+     *
+     * @param index The index of the person in the population
+     * @return A Person holding a copy of the person's info
+     */
+    Person GetPerson(size_t index) const;
+
+    /*
+     * Overwrites the info of one person in the arrays.
+     *
+     * @param index The index of the person in the population
+     * @param person The info to store
+     */
+    void SetPerson(size_t index, const Person& person);
+
+    /*
+     * Gathers the info of everyone in the population.
+     *
+     * @return A vector of everyone's info, in the order they were added
+     *     (i.e. indexed by id)
+     */
+    vector<Person> ToVector() const;
+
+    /*
+     * Gets where the person with the specified id is stored.
+     *
+     * @param person_id The id of the person
+     * @return The index of the person in the population
+     */
+    size_t GetIndex(uint32_t person_id) const;
+
+    vec2 GetPosition(size_t index) const;
+    vec2 GetVelocity(size_t index) const;
+    void SetPosition(size_t index, const vec2& position);
+    void SetVelocity(size_t index, const vec2& velocity);
+};
+
+}  // namespace disease
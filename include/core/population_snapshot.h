@@ -0,0 +1,35 @@
+#pragma once
+
+#include "core/population.h"
+
+namespace disease {
+
+/*
+ * The part of a population that's needed to draw it: each person's position,
+ * radius, color, and status, as a structure of arrays in population order.
+ * Copying into an existing snapshot reuses its arrays, so it only allocates
+ * when the population has grown.
+ */
+struct PopulationSnapshot {
+    vector<vec2> position;
+    vector<float> radius;
+    vector<vec3> color;
+    vector<Status> status;
+
+    size_t Size() const;
+    bool IsEmpty() const;
+
+    /*
+     * Removes everyone from the snapshot.
+     */
+    void Clear();
+
+    /*
+     * Overwrites the snapshot with the current state of a population.
+     *
+     * @param population The population to copy
+     */
+    void CopyFrom(const Population& population);
+};
+
+}  // namespace disease
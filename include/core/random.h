@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace disease {
+
+/*
+ * A counter-based random number generator (Philox4x32-10). Rather than
+ * advancing a shared state, every value is computed from the seed and the
+ * position it's drawn from, so values can be drawn from any number of
+ * independent streams (e.g. one per person) in any order, and the same seed
+ * always gives the same values no matter how or in what order they're drawn.
+ */
+class Random {
+ public:
+  const static uint64_t kDefaultSeed = 0x5eed5eed5eed5eedULL;
+
+  Random();
+  explicit Random(uint64_t seed);
+
+  void SetSeed(uint64_t seed);
+  uint64_t GetSeed() const;
+
+  /*
+   * Gets a random float uniformly distributed between the bounds.
+   *
+   * @param stream The stream to draw from (e.g. the index of a person)
+   * @param step The position within the stream (e.g. the current tick)
+   * @param draw Which of the values at that position to get, so that several
+   *     independent values can be drawn at the same position
+   * @param lower_bound The smallest value that can be returned
+   * @param upper_bound The largest value that can be returned
+   * @return A random float between the bounds
+   */
+  float GetFloat(uint64_t stream, uint32_t step, uint32_t draw,
+                 float lower_bound, float upper_bound) const;
+
+ private:
+  const static size_t kNumOfRounds = 10;
+
+  uint64_t seed_;
+
+  /*
+   * Scrambles the counter in place with the Philox4x32 rounds, keyed by the seed.
+   *
+   * @param counter The four 32-bit words of the counter
+   */
+  void Scramble(uint32_t counter[4]) const;
+};
+
+}  // namespace disease
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace disease {
+
+/*
+ * Summarizes a stream of whole-number samples between 0 and a known maximum
+ * (e.g. the number of people with a status) in a fixed amount of memory, no
+ * matter how many samples are added.
+ *
+ * The mean and variance are exact. Quantiles come from a histogram of
+ * kNumOfBins bins, so they're exact when the maximum is below kNumOfBins and
+ * interpolated within a bin (but never outside the samples' range)
+ * otherwise. Everything is kept as whole-number totals, so the summary
+ * doesn't depend on the order the samples were added in, or on how they were
+ * split between summaries that were merged.
+ */
+class RunningStatistics {
+ public:
+  const static size_t kNumOfBins = 128;
+
+  RunningStatistics();
+
+  /*
+   * @param maximum_value The largest sample that will be added (larger
+   *     samples are counted in the last bin)
+   */
+  explicit RunningStatistics(size_t maximum_value);
+
+  /*
+   * Adds a sample to the summary.
+   *
+   * @param value The sample to add
+   */
+  void Add(size_t value);
+
+  /*
+   * Adds every sample of another summary with the same maximum to this one.
+   *
+   * @param other The summary to add
+   */
+  void Merge(const RunningStatistics& other);
+
+  size_t GetNumOfSamples() const;
+  size_t GetMaximumValue() const;
+  double GetMean() const;
+  double GetVariance() const;  // i.e. the sample variance; 0 with fewer than 2 samples
+  double GetStandardDeviation() const;
+
+  /*
+   * Gets the smallest value that at least the specified fraction of the
+   * samples are less than or equal to.
+   *
+   * @param fraction The fraction of samples, between 0 and 1 (e.g. 0.5 for
+   *     the median)
+   * @return The quantile, or 0 if there are no samples
+   */
+  double GetQuantile(double fraction) const;
+
+ private:
+  size_t maximum_value_;
+  size_t bin_width_;  // i.e. the number of values counted in each bin
+
+  uint64_t num_of_samples_;
+  size_t smallest_sample_;
+  size_t largest_sample_;
+  uint64_t sum_;
+  uint64_t sum_of_squares_;
+  uint32_t bins_[kNumOfBins];
+};
+
+}  // namespace disease
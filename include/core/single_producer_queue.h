@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace disease {
+
+/*
+ * A fixed capacity queue that one thread pushes to and another pops from,
+ * without locks. Storage is allocated once, when the queue is created.
+ */
+template <typename T>
+class SingleProducerQueue {
+ public:
+  /*
+   * Creates an empty queue.
+   *
+   * @param capacity The most values the queue can hold at once
+   */
+  explicit SingleProducerQueue(size_t capacity)
+      : values_(capacity + 1), head_(0), tail_(0) {}
+
+  SingleProducerQueue(const SingleProducerQueue&) = delete;
+  SingleProducerQueue& operator=(const SingleProducerQueue&) = delete;
+
+  /*
+   * Adds a value to the back of the queue (producer thread only).
+   *
+   * @param value The value to add
+   * @return A bool representing if there was room for the value
+   */
+  bool TryPush(const T& value) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t next_tail = Next(tail);
+    if (next_tail == head_.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    values_[tail] = value;
+    tail_.store(next_tail, std::memory_order_release);
+    return true;
+  }
+
+  /*
+   * Removes the value at the front of the queue (consumer thread only).
+   *
+   * @param value Set to the value removed, if there was one
+   * @return A bool representing if there was a value to remove
+   */
+  bool TryPop(T& value) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    value = values_[head];
+    head_.store(Next(head), std::memory_order_release);
+    return true;
+  }
+
+  /*
+   * Checks if there's no room to push (producer thread only, since the
+   * consumer can make room at any time).
+   *
+   * @return A bool representing if the queue is full
+   */
+  bool IsFull() const {
+    return Next(tail_.load(std::memory_order_relaxed)) == head_.load(std::memory_order_acquire);
+  }
+
+  size_t GetCapacity() const {
+    return values_.size() - 1;
+  }
+
+ private:
+  std::vector<T> values_;  // one slot is always empty, to tell full from empty
+  std::atomic<size_t> head_;  // next to pop, written by the consumer
+  std::atomic<size_t> tail_;  // next to push to, written by the producer
+
+  size_t Next(size_t index) const {
+    return index + 1 == values_.size() ? 0 : index + 1;
+  }
+};
+
+}  // namespace disease
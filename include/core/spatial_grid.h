@@ -0,0 +1,206 @@
+#pragma once
+
+#include <glm/vec2.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using glm::vec2;
+using std::vector;
+
+namespace disease {
+
+/*
+ * Candidates that are stored next to each other in the grid (the cells of one
+ * row of a neighborhood), with copies of their positions and radii in the
+ * same order, so they can be compared in batches.
+ *
+ * indices: the population indices of the candidates
+ * positions_x, positions_y: where each candidate was when the grid was built
+ * radii: the radius of each candidate
+ * radii_single: the same radii, rounded to floats
+ * size: the number of candidates
+ */
+struct NeighborRun {
+    const size_t* indices;
+    const float* positions_x;
+    const float* positions_y;
+    const double* radii;
+    const float* radii_single;
+    size_t size;
+};
+
+/*
+ * A uniform grid (cell list) over the particles in the population. Every
+ * particle is placed in the square cell containing its center, so every
+ * particle within one cell size of a position lies in the 3x3 block of cells
+ * around that position.
+ *
+ * The grid is meant to be rebuilt once per frame from scratch; the buffers are
+ * reused between rebuilds so a rebuild doesn't allocate once they have grown.
+ */
+class SpatialGrid {
+ public:
+  SpatialGrid() = default;
+
+  /*
+   * Places every position into its cell.
+   *
+   * @param positions_x The x values of the particles' positions, indexed like
+   *     the population
+   * @param positions_y The y values of the particles' positions
+   * @param cell_size The side length of a cell; should be at least the largest
+   *     distance that will be queried
+   */
+  void Rebuild(const vector<float>& positions_x, const vector<float>& positions_y,
+               double cell_size);
+
+  /*
+   * Same as above, but also keeps each particle's radius for NeighborRuns
+   * (otherwise they're 0).
+   *
+   * @param radii The radius of each particle, indexed like the population
+   */
+  void Rebuild(const vector<float>& positions_x, const vector<float>& positions_y,
+               const vector<double>& radii, double cell_size);
+
+  /*
+   * Makes room for the specified number of particles, so rebuilding the grid
+   * with up to that many doesn't allocate.
+   *
+   * @param num_of_particles The most particles the grid will be rebuilt with
+   */
+  void Reserve(size_t num_of_particles);
+
+  size_t GetNumOfColumns() const;
+  size_t GetNumOfRows() const;
+  double GetCellSize() const;
+
+  /*
+   * Visits the index of every particle in the cell containing the position and
+   * in the eight cells around it. The visitor is called as visit(index) and
+   * returns false to stop the search early.
+   *
+   * @param position The position to search around (doesn't have to be in the grid)
+   * @param visit The callable to pass each index to
+   * @return A bool representing if every candidate was visited (i.e. the
+   *     visitor never stopped the search)
+   */
+  template <typename Visitor>
+  bool ForEachNeighbor(const vec2& position, Visitor visit) const;
+
+  /*
+   * Visits the same candidates as ForEachNeighbor, in the same order, but a
+   * NeighborRun (one row of the 3x3 block of cells) at a time. The visitor is
+   * called as visit(run) and returns false to stop the search early.
+   *
+   * @param position The position to search around (doesn't have to be in the grid)
+   * @param visit The callable to pass each NeighborRun to
+   * @return A bool representing if every run was visited
+   */
+  template <typename Visitor>
+  bool ForEachNeighborRun(const vec2& position, Visitor visit) const;
+
+ private:
+  // Cells stay at least this many times as many as the particles
+  const static size_t kMaxCellsPerParticle = 4;
+
+  double cell_size_ = 1;
+  double left_ = 0;
+  double top_ = 0;
+  size_t num_of_columns_ = 0;
+  size_t num_of_rows_ = 0;
+
+  // cell_starts_[cell] to cell_starts_[cell + 1] is the range of cell_items_
+  // that holds the indices of the particles in the cell
+  vector<size_t> cell_starts_;
+  vector<size_t> cell_items_;
+  vector<size_t> cell_of_item_;
+  vector<size_t> cell_cursors_;
+
+  // The positions and radii of the particles, in the same order as cell_items_
+  vector<float> cell_positions_x_;
+  vector<float> cell_positions_y_;
+  vector<double> cell_radii_;
+  vector<float> cell_radii_single_;
+
+  /*
+   * Gets the column or row of the cell a coordinate falls in, which may be
+   * outside of the grid.
+   *
+   * @param coordinate The x or y value of the position
+   * @param origin The left or top boundary of the grid
+   * @return A long representing the column or row
+   */
+  long CellCoordinate(double coordinate, double origin) const;
+};
+
+template <typename Visitor>
+bool SpatialGrid::ForEachNeighbor(const vec2& position, Visitor visit) const {
+  if (cell_items_.empty()) {
+    return true;
+  }
+
+  long center_column = CellCoordinate(position.x, left_);
+  long center_row = CellCoordinate(position.y, top_);
+
+  for (long row = center_row - 1; row <= center_row + 1; row++) {
+    if (row < 0 || row >= long(num_of_rows_)) {
+      continue;
+    }
+
+    for (long column = center_column - 1; column <= center_column + 1; column++) {
+      if (column < 0 || column >= long(num_of_columns_)) {
+        continue;
+      }
+
+      size_t cell = size_t(row) * num_of_columns_ + size_t(column);
+      for (size_t item = cell_starts_[cell]; item < cell_starts_[cell + 1]; item++) {
+        if (!visit(cell_items_[item])) {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+template <typename Visitor>
+bool SpatialGrid::ForEachNeighborRun(const vec2& position, Visitor visit) const {
+  if (cell_items_.empty()) {
+    return true;
+  }
+
+  long center_column = CellCoordinate(position.x, left_);
+  long center_row = CellCoordinate(position.y, top_);
+  long first_column = std::max(center_column - 1, 0L);
+  long last_column = std::min(center_column + 1, long(num_of_columns_) - 1);
+  if (first_column > last_column) {
+    return true;
+  }
+
+  for (long row = center_row - 1; row <= center_row + 1; row++) {
+    if (row < 0 || row >= long(num_of_rows_)) {
+      continue;
+    }
+
+    // The cells of a row are stored one after another
+    size_t row_start = size_t(row) * num_of_columns_;
+    size_t begin = cell_starts_[row_start + size_t(first_column)];
+    size_t end = cell_starts_[row_start + size_t(last_column) + 1];
+    if (begin == end) {
+      continue;
+    }
+
+    NeighborRun run = {&cell_items_[begin], &cell_positions_x_[begin], &cell_positions_y_[begin],
+                       &cell_radii_[begin], &cell_radii_single_[begin], end - begin};
+    if (!visit(run)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace disease
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "core/population.h"
+#include <atomic>
+
+namespace disease {
+
+/*
+ * A change in a person's health status.
+ *
+ * index: the index of the person in the population when they changed
+ * id: the id of the person (see Population), which stays the same when the
+ *     population is reordered
+ * from: the status the person had before the change
+ * to: the status the person has after the change
+ */
+struct StatusTransition {
+    size_t index;
+    uint32_t id;
+    Status from;
+    Status to;
+};
+
+/*
+ * Records the health status changes made during a tick. Changes can be
+ * recorded from several threads at once. There's room for one change per
+ * person, since nobody changes status more than once in a tick, so recording
+ * never allocates.
+ */
+class StatusTransitions {
+ public:
+  StatusTransitions();
+  StatusTransitions(const StatusTransitions& other);
+  StatusTransitions& operator=(const StatusTransitions& other);
+
+  /*
+   * Removes every recorded change and makes room for the specified number
+   * of people.
+   *
+   * @param num_of_people The number of people who could change status
+   */
+  void Reset(size_t num_of_people);
+
+  /*
+   * Records a change. Safe to call from several threads at once.
+   *
+   * @param index The index of the person in the population
+   * @param id The id of the person
+   * @param from The status the person had before the change
+   * @param to The status the person has after the change
+   */
+  void Record(size_t index, uint32_t id, Status from, Status to);
+
+  /*
+   * Puts the recorded changes in population order, so that the order doesn't
+   * depend on which threads recorded them.
+   */
+  void SortByIndex();
+
+  /*
+   * Adds the recorded changes to the counts of each status.
+   *
+   * @param status_counts The counts to change
+   */
+  void ApplyTo(StatusCounts& status_counts) const;
+
+  size_t Size() const;
+  bool IsEmpty() const;
+  const StatusTransition& operator[](size_t position) const;
+  const StatusTransition* begin() const;
+  const StatusTransition* end() const;
+
+ private:
+  vector<StatusTransition> transitions_;  // only the first size_ are recorded changes
+  std::atomic<size_t> size_;
+};
+
+}  // namespace disease
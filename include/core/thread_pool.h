@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace disease {
+
+/*
+ * A fixed set of worker threads that split loops over a range of indices
+ * between them. The range is always split into the same contiguous chunks for
+ * the same number of threads, and running a loop doesn't allocate.
+ */
+class ThreadPool {
+ public:
+  /*
+   * Starts the worker threads.
+   *
+   * @param num_of_threads The number of threads to run loops on, including the
+   *     thread calling ParallelFor (so 1 means loops run on the caller only)
+   */
+  explicit ThreadPool(size_t num_of_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  size_t GetNumOfThreads() const;
+
+  /*
+   * Calls the function for every index in [0, num_of_items), spread across the
+   * threads, and returns once every call has finished. The function may be
+   * called for different indices at the same time, so calls must only write
+   * to data belonging to their own index.
+   *
+   * @param num_of_items The number of indices to call the function for
+   * @param function The function to call with each index
+   */
+  template <typename Function>
+  void ParallelFor(size_t num_of_items, Function& function) {
+    Run(num_of_items, &CallForRange<Function>, &function);
+  }
+
+  /*
+   * Like ParallelFor, but hands out the indices one at a time to whichever
+   * thread is free, rather than in fixed chunks. Meant for a few items that
+   * take long and uneven times (e.g. whole simulation runs), so one slow item
+   * doesn't leave the other threads idle. Which thread calls the function for
+   * which index isn't fixed.
+   *
+   * @param num_of_items The number of indices to call the function for
+   * @param function The function to call with each index
+   */
+  template <typename Function>
+  void ParallelForBalanced(size_t num_of_items, Function& function) {
+    std::atomic<size_t> next_item(0);
+    auto take_items = [&](size_t) {
+      for (size_t item = next_item++; item < num_of_items; item = next_item++) {
+        function(item);
+      }
+    };
+    ParallelFor(GetNumOfThreads(), take_items);
+  }
+
+ private:
+  using RangeJob = void (*)(void* context, size_t begin, size_t end);
+
+  template <typename Function>
+  static void CallForRange(void* context, size_t begin, size_t end) {
+    Function& function = *static_cast<Function*>(context);
+    for (size_t index = begin; index < end; index++) {
+      function(index);
+    }
+  }
+
+  std::vector<std::thread> workers_;
+
+  // Only one loop runs at a time, even if the pool is shared
+  std::mutex run_mutex_;
+
+  // Guards everything below
+  std::mutex mutex_;
+  std::condition_variable work_ready_;
+  std::condition_variable work_done_;
+  size_t generation_;  // i.e. the number of loops started so far
+  size_t num_of_busy_workers_;
+  bool is_stopping_;
+
+  RangeJob job_;
+  void* job_context_;
+  size_t num_of_items_;
+
+  /*
+   * Splits the range into one chunk per thread, runs the chunks, and waits
+   * for all of them to finish.
+   */
+  void Run(size_t num_of_items, RangeJob job, void* context);
+
+  /*
+   * Runs the chunk belonging to the specified thread.
+   *
+   * @param thread_index The index of the thread (0 is the calling thread)
+   */
+  void RunChunk(size_t thread_index) const;
+
+  /*
+   * Waits for loops to be started and runs this worker's chunk of each one.
+   *
+   * @param thread_index The index of the worker's thread
+   */
+  void WorkerLoop(size_t thread_index);
+};
+
+}  // namespace disease
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace disease {
+
+/*
+ * The parts of a tick that are timed separately. Movement includes the time
+ * spent social distancing, since people decide how to distance as they move.
+ */
+enum class TickPhase {
+  kTick,              // all of UpdateParticles
+  kReorder,           // only on ticks the population is sorted
+  kResetFrame,        // includes rebuilding the neighbor grid
+  kFindInteractions,  // only when updating in two phases
+  kStatusUpdate,
+  kCentralLocation,
+  kWallCollisions,
+  kSocialDistance,
+  kMovement,          // quarantine and position updates
+};
+
+/*
+ * The average cost of a tick over some number of ticks.
+ *
+ * num_of_ticks: the number of ticks averaged over
+ * microseconds: the average time spent in each TickPhase, indexed by phase
+ *     (summed across threads when updating in two phases)
+ * pair_tests: the average number of times two people's distance was checked
+ * allocations: the average number of allocations made (by any thread) during
+ *     a tick (see core/allocation_counter.h)
+ */
+struct TickProfile {
+    const static size_t kNumOfPhases = 9;
+
+    size_t num_of_ticks = 0;
+    double microseconds[kNumOfPhases] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    double pair_tests = 0;
+    double allocations = 0;
+
+    double GetMicroseconds(TickPhase phase) const;
+
+    /*
+     * Gets the name of a phase, to label its timing with.
+     *
+     * @param phase The TickPhase to name
+     * @return The phase's name
+     */
+    static const char* GetPhaseName(TickPhase phase);
+};
+
+/*
+ * Collects how long each phase of a tick takes, how many pair tests are made,
+ * and how many allocations are made, and averages them over the last
+ * kNumOfTicksAveraged ticks and over every tick since it was last cleared.
+ *
+ * The timers and counters are only compiled in when DISEASE_ENABLE_PROFILING
+ * is defined (see DISEASE_PROFILE_PHASE and DISEASE_COUNT_PAIR_TESTS); otherwise
+ * every profile is empty and ticks don't pay for profiling. Times and counts
+ * can be added from several threads at once.
+ */
+class TickProfiler {
+ public:
+#ifdef DISEASE_ENABLE_PROFILING
+  const static bool kIsEnabled = true;
+#else
+  const static bool kIsEnabled = false;
+#endif
+  const static size_t kNumOfTicksAveraged = 60;
+
+  TickProfiler();
+  TickProfiler(const TickProfiler& other);
+  TickProfiler& operator=(const TickProfiler& other);
+
+  /*
+   * Adds time spent in a phase to the current tick. Safe to call from several
+   * threads at once.
+   *
+   * @param phase The TickPhase the time was spent in
+   * @param nanoseconds The time spent
+   */
+  void AddTime(TickPhase phase, uint64_t nanoseconds);
+
+  /*
+   * Counts checks of the distance between two people in the current tick.
+   * Safe to call from several threads at once.
+   *
+   * @param num_of_pair_tests The number of pairs checked
+   */
+  void AddPairTests(uint64_t num_of_pair_tests);
+
+  /*
+   * Starts collecting a new tick.
+   */
+  void StartTick();
+
+  /*
+   * Adds the current tick to the averages.
+   */
+  void EndTick();
+
+  /*
+   * Removes every tick collected so far.
+   */
+  void Clear();
+
+  /*
+   * Averages the last kNumOfTicksAveraged ticks (or fewer, if fewer have run).
+   *
+   * @return The average TickProfile of the recent ticks
+   */
+  TickProfile GetRecentAverage() const;
+
+  /*
+   * Averages every tick since the profiler was last cleared.
+   *
+   * @return The average TickProfile of every tick
+   */
+  TickProfile GetOverallAverage() const;
+
+ private:
+  /*
+   * The totals of one or more ticks.
+   */
+  struct TickTotals {
+      uint64_t nanoseconds[TickProfile::kNumOfPhases] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+      uint64_t pair_tests = 0;
+      uint64_t allocations = 0;
+
+      void Add(const TickTotals& other);
+      TickProfile GetAverage(size_t num_of_ticks) const;
+  };
+
+  // The current tick, which may be added to by several threads
+  std::atomic<uint64_t> current_nanoseconds_[TickProfile::kNumOfPhases];
+  std::atomic<uint64_t> current_pair_tests_;
+  uint64_t allocations_at_tick_start_;
+
+  // The last kNumOfTicksAveraged ticks, oldest overwritten first
+  TickTotals recent_ticks_[kNumOfTicksAveraged];
+  size_t num_of_recent_ticks_;
+  size_t next_recent_tick_;
+
+  TickTotals overall_totals_;
+  size_t num_of_ticks_;
+};
+
+/*
+ * Adds the time from its creation to its destruction to a phase.
+ */
+class ScopedPhaseTimer {
+ public:
+  ScopedPhaseTimer(TickProfiler& profiler, TickPhase phase);
+  ~ScopedPhaseTimer();
+
+  ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+  ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+ private:
+  TickProfiler& profiler_;
+  TickPhase phase_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace disease
+
+// Times the rest of the enclosing scope as the phase, and counts pair tests,
+// when profiling is compiled in; otherwise they compile to nothing
+#ifdef DISEASE_ENABLE_PROFILING
+#define DISEASE_PROFILE_CONCATENATE_INNER(first, second) first##second
+#define DISEASE_PROFILE_CONCATENATE(first, second) DISEASE_PROFILE_CONCATENATE_INNER(first, second)
+#define DISEASE_PROFILE_PHASE(profiler, phase) \
+  ::disease::ScopedPhaseTimer DISEASE_PROFILE_CONCATENATE(scoped_phase_timer_, __LINE__)(profiler, phase)
+#define DISEASE_COUNT_PAIR_TESTS(profiler, num_of_pair_tests) (profiler).AddPairTests(num_of_pair_tests)
+#else
+#define DISEASE_PROFILE_PHASE(profiler, phase) ((void)0)
+#define DISEASE_COUNT_PAIR_TESTS(profiler, num_of_pair_tests) ((void)0)
+#endif
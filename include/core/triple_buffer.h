@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace disease {
+
+/*
+ * Hands values from one writer thread to one reader thread without locks.
+ * There are three buffers: the writer fills one, the reader reads another,
+ * and the third holds the latest published value. Publishing and taking swap
+ * a buffer with that third one, so neither side ever waits on the other or
+ * copies the other's buffer. The reader always gets the latest published
+ * value; the ones published in between are skipped.
+ *
+ * Buffers are reused, so a writer that overwrites its buffer in place (e.g.
+ * with vector::assign) stops allocating once every buffer has grown.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() : write_index_(0), read_index_(1), latest_(2) {}
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  /*
+   * Gets the buffer to fill before publishing (writer thread only). It holds
+   * whatever was last written to it, which may be a few publishes old.
+   *
+   * @return The buffer the writer owns
+   */
+  T& GetWriteBuffer() {
+    return buffers_[write_index_];
+  }
+
+  /*
+   * Makes the write buffer the latest value and gives the writer the
+   * previous latest buffer to fill next (writer thread only).
+   */
+  void Publish() {
+    uint8_t previous = latest_.exchange(uint8_t(write_index_ | kHasNewValue),
+                                        std::memory_order_acq_rel);
+    write_index_ = uint8_t(previous & kIndexMask);
+  }
+
+  /*
+   * Makes the latest published value the read buffer, if anything has been
+   * published since it was last taken (reader thread only).
+   *
+   * @return A bool representing if the read buffer changed
+   */
+  bool TakeLatest() {
+    if ((latest_.load(std::memory_order_relaxed) & kHasNewValue) == 0) {
+      return false;
+    }
+
+    uint8_t previous = latest_.exchange(read_index_, std::memory_order_acq_rel);
+    read_index_ = uint8_t(previous & kIndexMask);
+    return true;
+  }
+
+  /*
+   * Gets the value last taken (reader thread only).
+   *
+   * @return The buffer the reader owns
+   */
+  const T& GetReadBuffer() const {
+    return buffers_[read_index_];
+  }
+
+ private:
+  const static uint8_t kIndexMask = 0x3;
+  const static uint8_t kHasNewValue = 0x4;
+
+  T buffers_[3];
+  uint8_t write_index_;  // only touched by the writer
+  uint8_t read_index_;  // only touched by the reader
+  std::atomic<uint8_t> latest_;  // the latest buffer's index, and if it's been taken
+};
+
+}  // namespace disease
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "cinder/gl/gl.h"
+#include "core/histogram.h"
+
+namespace disease {
+
+namespace visualizer {
+
+/*
+ * Draws a Histogram of the population's health status next to the container
+ * in the Cinder app/simulator.
+ *
+ * The bins are drawn from the histogram's downsampled bins, so drawing costs
+ * the same however long the outbreak has gone on. Their vertices are laid out
+ * in frames and people, and kept in a vertex buffer that only has the newly
+ * filled bins appended to it each frame; they're scaled to fit the graph as
+ * time goes on by the model matrix. If the vertex buffer can't be set up,
+ * each bin is drawn with its own rects instead.
+ */
+class HistogramDrawer {
+ private:
+  const size_t kNumOfStatuses = 4;
+
+  // ================================
+  // Constants for drawing histograms
+  // ================================
+  const double kHistogramGraphDimension = 300;  // length and width of histogram graph
+  const size_t kLabelSpacingFromHistogram = 10;
+  const size_t kLabelSpacingFromHistogramTimes2 = 20;
+  const size_t kSpacingFromContainer = 125;
+
+  vec2 container_top_right_corner_;
+
+  /*
+   * A corner of a bin's rects, in frames (x) and people (y, up from the x axis).
+   */
+  struct BinVertex {
+      vec2 position;
+      vec3 color;
+  };
+
+  const size_t kVerticesPerBin = 18;  // two triangles for each status drawn
+
+  // The vertices of the full bins drawn so far, created on the first draw
+  mutable bool has_bin_mesh_failed_ = false;
+  mutable size_t num_of_bins_in_mesh_ = 0;
+  mutable size_t bin_layout_version_in_mesh_ = 0;
+  mutable vector<BinVertex> new_bin_vertices_;  // reused to stage the appended bins
+  mutable ci::gl::VboRef bin_vertex_buffer_;
+  mutable ci::gl::BatchRef bin_batch_;
+
+  // Info regarding placement of histogram stuff
+  size_t bottom_most_boundary_of_histogram_;
+  size_t x_coordinate_of_status_stat_labels_;
+
+  /*
+   * Draws the background of the histogram (i.e. the graph).
+   *
+   * @param left_boundary_of_histogram The left boundary of the histogram
+   * @param top_left_corner_y The y value of the top left corner of the histogram
+   * @return A vector holding the vec2 values of the top left and bottom right
+   *     corners of the histogram, in that order
+   */
+  vector<vec2> DrawHistogramBackground(double left_boundary_of_histogram,
+                                       double histogram_top_left_corner_y) const;
+
+  /*
+   * Draws the bins of the histogram.
+   *
+   * @param histogram The Histogram holding the info to draw
+   * @param left_boundary_of_histogram The left boundary of the histogram
+   * @param top_left_corner_y The y value of the top left corner of the histogram
+   */
+  void DrawHistogramBins(const Histogram& histogram, double left_boundary_of_histogram,
+                         double histogram_top_left_corner_y) const;
+
+  /*
+   * Appends the vertices of the full bins that aren't in the vertex buffer
+   * yet, after rebuilding it if the bins have been merged or removed.
+   *
+   * @param histogram The Histogram holding the bins to draw
+   * @param num_of_full_bins The number of bins that won't gain more frames
+   * @return A bool representing if the vertex buffer can be drawn
+   */
+  bool UpdateBinMesh(const Histogram& histogram, size_t num_of_full_bins) const;
+
+  /*
+   * Adds the vertices of a bin's rects (symptomatic and asymptomatic stacked
+   * up from the x axis, removed hanging from the top) to a vector.
+   *
+   * @param bin The HistogramBin to add the vertices of
+   * @param left_x The frame the bin starts at
+   * @param right_x The frame after the last frame in the bin
+   * @param upper_bound_for_y The number of people at the top of the graph
+   * @param vertices The vector to add the vertices to
+   */
+  void AddBinVertices(const HistogramBin& bin, double left_x, double right_x,
+                      double upper_bound_for_y, vector<BinVertex>& vertices) const;
+
+  /*
+   * Draws a bin's rects one by one, in the same units as AddBinVertices.
+   *
+   * @param bin The HistogramBin to draw
+   * @param left_x The frame the bin starts at
+   * @param right_x The frame after the last frame in the bin
+   * @param upper_bound_for_y The number of people at the top of the graph
+   */
+  void DrawBin(const HistogramBin& bin, double left_x, double right_x,
+               double upper_bound_for_y) const;
+
+  /*
+   * Draws a bin for a specific health status.
+   *
+   * @param bin_top_left_x A double of the x coordinate of the top left corner
+   *     of the bin
+   * @param bin_top_left_y A double of the y coordinate of the top left corner
+   *     of the bin
+   * @param bin_bottom_right_x A double of the x coordinate of the bottom
+   *     right corner of the bin
+   * @param bin_bottom_right_y A double of the y coordinate of the bottom
+   *     right corner of the bin
+   * @param color A vec3 of the color of the health status
+   */
+  void DrawStatusBin(double bin_top_left_x, double bin_top_left_y,
+                     double bin_bottom_right_x, double bin_bottom_right_y,
+                     const vec3& color) const;
+
+  /*
+   * Draws the labels of the histogram for the axes and title.
+   *
+   * @param histogram The Histogram holding the info to draw
+   * @param left_boundary_of_histogram The left boundary of the histogram
+   * @param top_left_corner_y The y value of the top left corner of the histogram
+   */
+  void DrawHistogramLabels(const Histogram& histogram, double left_boundary_of_histogram,
+                           double histogram_top_left_corner_y) const;
+
+  /*
+   * Draws the axes labels of the histogram.
+   *
+   * @param left_boundary_of_histogram The left boundary of the histogram
+   * @param top_left_corner_y The y value of the top left corner of the histogram
+   */
+  void DrawAxesLabels(double left_boundary_of_histogram,
+                      double histogram_top_left_corner_y) const;
+
+  /*
+   * Draws the labels of the axes bounds.
+   *
+   * @param histogram The Histogram holding the info to draw
+   * @param left_boundary_of_histogram The left boundary of the histogram
+   * @param top_left_corner_y The y value of the top left corner of the histogram
+   */
+  void DrawBoundsLabels(const Histogram& histogram, double left_boundary_of_histogram,
+                        double histogram_top_left_corner_y) const;
+
+  /*
+   * Draws the status statistics of the population.
+   *
+   * @param histogram The Histogram holding the info to draw
+   */
+  void DrawStatusStatistics(const Histogram& histogram) const;
+
+ public:
+  HistogramDrawer() = default;
+  HistogramDrawer(const vec2& container_top_right_corner);
+
+  size_t GetBottomMostBoundaryOfHistogram() const;  // i.e. y coordinate below the x axis label
+  size_t GetXCoordinateOfStatusStatLabels() const;
+  size_t GetYCoordinateOfLastStatusStatLabel() const;
+
+  /*
+   * Draws the histogram.
+   *
+   * @param histogram The Histogram holding the info to draw
+   */
+  void DrawHistogram(const Histogram& histogram) const;
+};
+
+}  // namespace visualizer
+
+}  // namespace disease
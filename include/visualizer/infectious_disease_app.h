@@ -25,6 +25,7 @@ class InfectiousDiseaseApp : public ci::app::App {
 
  private:
   Simulator simulator_;
+  double last_update_time_;  // in seconds since the app started
 };
 
 }  // namespace visualizer
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "cinder/gl/gl.h"
+#include "core/population_snapshot.h"
+#include <cstddef>
+
+namespace disease {
+
+namespace visualizer {
+
+/*
+ * Draws the particles of a population snapshot in the Cinder app/simulator.
+ *
+ * By default every particle is drawn in one instanced draw call: each frame,
+ * the particles' positions, radii, and colors are written into a single
+ * vertex buffer, and one circle mesh is drawn once per particle. If the
+ * instancing shader can't be set up (e.g. an old GL driver), or instancing is
+ * turned off, each particle is drawn with its own draw call instead.
+ */
+class ParticleDrawer {
+ public:
+  ParticleDrawer();
+
+  /*
+   * Draws every particle in the snapshot.
+   *
+   * @param particles The PopulationSnapshot holding the particles to draw
+   */
+  void DrawParticles(const PopulationSnapshot& particles) const;
+
+  /*
+   * Sets if the particles should be drawn in one instanced draw call. Drawing
+   * falls back to one draw call per particle if instancing isn't available.
+   *
+   * @param is_instanced A bool representing if instancing should be used
+   */
+  void SetIsInstanced(bool is_instanced);
+  bool GetIsInstanced() const;  // i.e. if instancing is on and available
+
+ private:
+  /*
+   * The info of one particle in the instance buffer, laid out as the
+   * shader reads it.
+   */
+  struct ParticleInstance {
+      vec2 position;
+      float radius;
+      vec3 color;
+  };
+
+  // The position and radius are read as one three float attribute
+  static_assert(offsetof(ParticleInstance, radius) == offsetof(ParticleInstance, position) + sizeof(vec2),
+                "radius has to come right after position in ParticleInstance");
+
+  const size_t kCircleSubdivisions = 24;
+  const size_t kMinimumInstanceCapacity = 256;
+
+  bool is_instanced_;
+
+  // Created on the first instanced draw, and recreated when the population
+  // outgrows the instance buffer
+  mutable bool has_instancing_failed_;
+  mutable size_t instance_capacity_;
+  mutable ci::gl::GlslProgRef shader_;
+  mutable ci::gl::VboRef instance_buffer_;
+  mutable ci::gl::BatchRef batch_;
+
+  /*
+   * Makes sure the shader is compiled and the instance buffer has room for
+   * the specified number of particles.
+   *
+   * @param num_of_particles The number of particles that will be drawn
+   * @return A bool representing if instanced drawing is ready
+   */
+  bool PrepareInstancing(size_t num_of_particles) const;
+
+  /*
+   * Draws the particles in one draw call, by copying them into the instance
+   * buffer and drawing the circle mesh once per particle.
+   *
+   * @param particles The PopulationSnapshot holding the particles to draw
+   */
+  void DrawInstanced(const PopulationSnapshot& particles) const;
+
+  /*
+   * Draws the particles with one draw call each.
+   *
+   * @param particles The PopulationSnapshot holding the particles to draw
+   */
+  void DrawOneByOne(const PopulationSnapshot& particles) const;
+};
+
+}  // namespace visualizer
+
+}  // namespace disease
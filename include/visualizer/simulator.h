@@ -3,6 +3,16 @@
 #include "cinder/gl/gl.h"
 #include "core/histogram.h"
 #include "core/infectious_disease.h"
+#include "core/population_snapshot.h"
+#include "core/single_producer_queue.h"
+#include "core/tick_profiler.h"
+#include "core/triple_buffer.h"
+#include "visualizer/histogram_drawer.h"
+#include "visualizer/particle_drawer.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 using disease::Disease;
 
@@ -28,12 +38,60 @@ class Simulator {
    * Creates a simulator.
    */
   Simulator();
+  ~Simulator();
+
+  Simulator(const Simulator&) = delete;
+  Simulator& operator=(const Simulator&) = delete;
 
   /*
-   * Updates particles' info.
+   * Updates particles' info (i.e. runs one tick).
    */
   void Update();
 
+  /*
+   * Advances the simulation by the time since the last frame. Ticks run at a
+   * fixed rate (kTicksPerSecond times the ticks per frame multiplier), no
+   * matter how often frames are drawn. At max speed, the ticks run on a
+   * background thread instead, and this takes the latest info it published.
+   *
+   * @param elapsed_seconds The time since the simulation was last advanced
+   */
+  void Advance(double elapsed_seconds);
+
+  /*
+   * Sets how many ticks run per frame (at kTicksPerSecond frames per second).
+   *
+   * @param ticks_per_frame The number of ticks per frame, between 1 and
+   *     kMaximumTicksPerFrame
+   */
+  void SetTicksPerFrame(size_t ticks_per_frame);
+
+  /*
+   * Switches to running ticks on a background thread as fast as possible.
+   * The particles drawn are the latest snapshot published by that thread;
+   * neither thread waits on the other to hand it over.
+   *
+   * @param is_running_at_max_speed A bool representing if the simulation
+   *     should run at max speed
+   */
+  void SetIsRunningAtMaxSpeed(bool is_running_at_max_speed);
+
+  /*
+   * Sets if the particles should be drawn in one instanced draw call, rather
+   * than one draw call each.
+   *
+   * @param is_drawing_instanced A bool representing if instancing should be used
+   */
+  void SetIsDrawingInstanced(bool is_drawing_instanced);
+
+  /*
+   * Sets if how long each phase of the recent ticks took should be drawn over
+   * the container. Has no effect unless DISEASE_ENABLE_PROFILING is defined.
+   *
+   * @param is_showing_tick_profile A bool representing if the profile should be drawn
+   */
+  void SetIsShowingTickProfile(bool is_showing_tick_profile);
+
   /*
    * Displays the current state of the sketchpad in the Cinder application.
    */
@@ -69,10 +127,16 @@ class Simulator {
    * @return A string that holds the feature name
    */
   std::string GetFeatureBeingChanged() const;
-  const vector<Disease::Person>& GetParticlesInfo();
+  const PopulationSnapshot& GetParticlesInfo() const;  // the snapshot being drawn
   size_t GetTimePassed() const;
+  size_t GetTicksPerFrame() const;
+  size_t GetMaximumTicksPerFrame() const;
+  bool GetIsRunningAtMaxSpeed() const;
+  bool GetIsDrawingInstanced() const;  // false if instancing isn't available
+  bool GetIsShowingTickProfile() const;  // false if profiling isn't compiled in
+  const TickProfile& GetTickProfile() const;  // the recent ticks, as of the snapshot being drawn
   FeatureChangeKey GetFeatureCurrentlyChanging() const;
-  Disease GetDiseaseClass() const;
+  Disease GetDiseaseClass() const;  // not while running at max speed
   double GetTopMargin();
   double GetRightMargin();
   double GetYLocForEnterInstructions();
@@ -100,13 +164,94 @@ class Simulator {
   const double kInitialYLocForFeatureStats = 100;
   const double kInitialYLocForGeneralInstructionsMultiplier = 3;
   const double kNumOfFeatures = 6;
+  const double kTickProfileMargin = 10;  // between the container and the tick profile
+
+  bool is_showing_tick_profile_;
 
   Disease disease_;
   Histogram histogram_;
-  vector<Disease::Person> particles_info;
+  HistogramDrawer histogram_drawer_;
+  ParticleDrawer particle_drawer_;
   size_t time_passed_;
   FeatureChangeKey feature_currently_being_changed_;
-  const size_t kIncrementOrDecrementBy = 5;
+
+  // ===========
+  // Tick pacing
+  // ===========
+  const double kTicksPerSecond = 60;
+  const size_t kMaximumTicksPerFrame = 64;
+  const double kMaximumFramesToCatchUp = 4;  // so slow frames don't snowball
+  const double kSecondsBetweenPublishes = 1.0 / 120;  // at max speed
+  const static size_t kMaximumUntakenTicks = 16384;  // at max speed, before the ticks wait on drawing
+  size_t ticks_per_frame_;
+  double tick_accumulator_;  // i.e. the ticks owed (fractional) since the last frame
+
+  // ==============================================
+  // Max speed (ticks run on the background thread)
+  // ==============================================
+  bool is_running_at_max_speed_;
+  std::thread worker_;
+  std::atomic<bool> should_stop_worker_;
+
+  // The worker sleeps on this while the queue of status counts is full, and
+  // is woken once the drawing thread takes some or the worker is stopped
+  std::mutex worker_mutex_;
+  std::condition_variable worker_can_continue_;
+
+  // Written by whichever thread runs the ticks and taken by the drawing thread,
+  // without locks. Every tick's status counts are queued for the histogram,
+  // but only the latest particles are kept.
+  TripleBuffer<PopulationSnapshot> snapshots_;
+  TripleBuffer<TickProfile> tick_profiles_;  // published with the particles
+  SingleProducerQueue<StatusCounts> published_status_counts_;
+
+  /*
+   * Runs one tick of the disease and updates the histogram, without updating
+   * the particles' info.
+   */
+  void RunTick();
+
+  /*
+   * Makes sure the radius of infection is larger than the social distance.
+   */
+  void KeepInfectionRadiusAboveSocialDistance();
+
+  /*
+   * Starts the background thread if running at max speed and there's a
+   * population to update.
+   */
+  void StartWorker();
+
+  /*
+   * Stops the background thread (if it's running) and takes what it last published.
+   */
+  void StopWorker();
+
+  /*
+   * Runs ticks until told to stop, queueing each tick's status counts and
+   * publishing a snapshot of the particles every kSecondsBetweenPublishes
+   * (runs on the background thread). Waits without spinning while the queue
+   * is full, e.g. while the window is minimized and nothing is drawn.
+   */
+  void RunAtMaxSpeed();
+
+  /*
+   * Copies the particles (and the recent ticks' profile, if profiling) into
+   * the snapshot being written and publishes it.
+   */
+  void PublishParticles();
+
+  /*
+   * Takes the latest snapshot of the particles and profile, without the
+   * queued status counts.
+   */
+  void TakeLatestParticles();
+
+  /*
+   * Takes the latest snapshot of the particles and adds the queued status
+   * counts to the histogram, waking the worker if it was waiting for room.
+   */
+  void TakeLatestSnapshot();
 
   /*
    * Draws the container.
@@ -123,6 +268,12 @@ class Simulator {
    */
   void DrawParticles() const;
 
+  /*
+   * Draws how long each phase of the recent ticks took, in the container's
+   * top left corner.
+   */
+  void DrawTickProfile() const;
+
   /*
    * Draws the quarantine box.
    */
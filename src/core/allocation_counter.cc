@@ -0,0 +1,21 @@
+#include "core/allocation_counter.h"
+
+#include <atomic>
+
+namespace disease {
+
+namespace {
+
+std::atomic<uint64_t> num_of_allocations(0);
+
+}  // namespace
+
+uint64_t GetNumOfAllocations() {
+  return num_of_allocations.load(std::memory_order_relaxed);
+}
+
+void CountAllocation() {
+  num_of_allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace disease
@@ -0,0 +1,71 @@
+#include "core/batch_runner.h"
+
+namespace disease {
+
+BatchRunner::BatchRunner() {
+  disease_ = Disease(kLeftContainerMargin, kTopContainerMargin, kContainerHeight, kContainerWidth,
+                     vec2(), vec2(), vec2(), vec2());
+  SetWorldSize(kContainerWidth, kContainerHeight);
+}
+
+void BatchRunner::SetWorldSize(double container_width, double container_height) {
+  double width_scale = container_width / kContainerWidth;
+  double height_scale = container_height / kContainerHeight;
+
+  disease_.SetContainerBounds(kLeftContainerMargin, kTopContainerMargin, container_height, container_width);
+
+  double container_right = kLeftContainerMargin + container_width;
+  double container_bottom = kTopContainerMargin + container_height;
+  vec2 quarantine_top_left(container_right + kSpacesFromContainer,
+                           container_bottom - kQuarantineBoxHeight * height_scale);
+  disease_.SetQuarantineBounds(quarantine_top_left,
+                               vec2(quarantine_top_left.x + kQuarantineBoxWidth * width_scale,
+                                    container_bottom));
+
+  double location_width = kLocationDimension * width_scale;
+  double location_height = kLocationDimension * height_scale;
+  vec2 location_top_left((kLeftContainerMargin + container_right - location_width) / 2,
+                         (kTopContainerMargin + container_bottom - location_height) / 2);
+  disease_.SetLocationBounds(location_top_left,
+                             location_top_left + vec2(location_width, location_height));
+}
+
+Disease& BatchRunner::GetDisease() {
+  return disease_;
+}
+
+void BatchRunner::Run(size_t num_of_ticks, std::ostream& output) {
+  disease_.CreatePopulation();
+
+  output << "tick,susceptible,symptomatic,asymptomatic,removed\n";
+  WriteStatusCounts(0, output);
+
+  for (size_t tick = 1; tick <= num_of_ticks; tick++) {
+    disease_.UpdateParticles();
+    WriteStatusCounts(tick, output);
+  }
+}
+
+void BatchRunner::WriteProfile(std::ostream& output) const {
+  TickProfile profile = disease_.GetTickProfiler().GetOverallAverage();
+
+  output << "phase,microseconds per tick\n";
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    output << TickProfile::GetPhaseName(TickPhase(phase)) << ','
+           << profile.microseconds[phase] << '\n';
+  }
+  output << "pair tests per tick," << profile.pair_tests << '\n'
+         << "allocations per tick," << profile.allocations << '\n'
+         << "ticks," << profile.num_of_ticks << '\n';
+}
+
+void BatchRunner::WriteStatusCounts(size_t tick, std::ostream& output) const {
+  const StatusCounts& status_counts = disease_.GetStatusCounts();
+
+  output << tick << ',' << status_counts[Status::kSusceptible] << ','
+         << status_counts[Status::kSymptomatic] << ','
+         << status_counts[Status::kAsymptomatic] << ','
+         << status_counts[Status::kRemoved] << '\n';
+}
+
+}  // namespace disease
@@ -0,0 +1,67 @@
+#include "core/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+// Replaces every form of the global operator new and delete, so that all of
+// them allocate with malloc and free with free, and every allocation is
+// counted (see core/allocation_counter.h). Only linked into the programs that
+// need the count, since it changes how the whole program allocates.
+
+namespace {
+
+void* Allocate(size_t size) noexcept {
+  disease::CountAllocation();
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void* AllocateOrThrow(size_t size) {
+  void* memory = Allocate(size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+  return AllocateOrThrow(size);
+}
+
+void* operator new[](size_t size) {
+  return AllocateOrThrow(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return Allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return Allocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+  std::free(memory);
+}
+
+// The sized forms, which the standard library may have been built to call
+void operator delete(void* memory, size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+  std::free(memory);
+}
@@ -0,0 +1,242 @@
+#include "core/distance_kernel.h"
+
+// The vectorized kernels are compiled for their instruction sets function by
+// function, so the rest of the build doesn't need them and the CPU is only
+// asked for them at runtime
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DISEASE_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace disease {
+
+namespace {
+
+uint32_t FindWithinDistanceScalar(float position_x, float position_y, double reach,
+                                  const float* candidates_x, const float* candidates_y,
+                                  const double* candidate_radii, size_t num_of_candidates) {
+  uint32_t hits = 0;
+  for (size_t candidate = 0; candidate < num_of_candidates; candidate++) {
+    if (IsWithinDistance(position_x, position_y, reach, candidates_x[candidate],
+                         candidates_y[candidate], candidate_radii[candidate])) {
+      hits |= uint32_t(1) << candidate;
+    }
+  }
+  return hits;
+}
+
+uint32_t FindWithinDistanceSingleScalar(float position_x, float position_y, float reach,
+                                        const float* candidates_x, const float* candidates_y,
+                                        const float* candidate_radii, size_t num_of_candidates) {
+  uint32_t hits = 0;
+  for (size_t candidate = 0; candidate < num_of_candidates; candidate++) {
+    if (IsWithinDistanceSingle(position_x, position_y, reach, candidates_x[candidate],
+                               candidates_y[candidate], candidate_radii[candidate])) {
+      hits |= uint32_t(1) << candidate;
+    }
+  }
+  return hits;
+}
+
+#ifdef DISEASE_HAS_X86_KERNELS
+/*
+ * Compares four candidates whose differences are in the lower or upper half
+ * of the float vectors.
+ */
+__attribute__((target("avx2")))
+uint32_t CompareFourAvx2(__m128 difference_x, __m128 difference_y, __m256d reach,
+                         const double* candidate_radii, __m256i load_mask) {
+  __m256d wide_x = _mm256_cvtps_pd(difference_x);
+  __m256d wide_y = _mm256_cvtps_pd(difference_y);
+  __m256d squared_distance = _mm256_add_pd(_mm256_mul_pd(wide_x, wide_x),
+                                           _mm256_mul_pd(wide_y, wide_y));
+
+  __m256d threshold = _mm256_add_pd(reach, _mm256_maskload_pd(candidate_radii, load_mask));
+  __m256d is_within = _mm256_cmp_pd(squared_distance, _mm256_mul_pd(threshold, threshold), _CMP_LE_OQ);
+  return uint32_t(_mm256_movemask_pd(_mm256_and_pd(is_within, _mm256_castsi256_pd(load_mask))));
+}
+
+__attribute__((target("avx2")))
+uint32_t FindWithinDistanceAvx2(float position_x, float position_y, double reach,
+                                const float* candidates_x, const float* candidates_y,
+                                const double* candidate_radii, size_t num_of_candidates) {
+  const __m256i kLaneIndices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i kWideLaneIndices = _mm256_setr_epi64x(0, 1, 2, 3);
+  __m256 point_x = _mm256_set1_ps(position_x);
+  __m256 point_y = _mm256_set1_ps(position_y);
+  __m256d wide_reach = _mm256_set1_pd(reach);
+
+  uint32_t hits = 0;
+  for (size_t first = 0; first < num_of_candidates; first += 8) {
+    long long num_left = (long long)(num_of_candidates - first);
+    __m256i float_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(num_left < 8 ? num_left : 8)),
+                                            kLaneIndices);
+    __m256 difference_x = _mm256_sub_ps(point_x, _mm256_maskload_ps(candidates_x + first, float_mask));
+    __m256 difference_y = _mm256_sub_ps(point_y, _mm256_maskload_ps(candidates_y + first, float_mask));
+
+    __m256i lower_mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(num_left), kWideLaneIndices);
+    __m256i upper_mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(num_left - 4), kWideLaneIndices);
+
+    uint32_t lower_hits = CompareFourAvx2(_mm256_castps256_ps128(difference_x),
+                                          _mm256_castps256_ps128(difference_y),
+                                          wide_reach, candidate_radii + first, lower_mask);
+    uint32_t upper_hits = CompareFourAvx2(_mm256_extractf128_ps(difference_x, 1),
+                                          _mm256_extractf128_ps(difference_y, 1),
+                                          wide_reach, candidate_radii + first + 4, upper_mask);
+    hits |= (lower_hits | (upper_hits << 4)) << first;
+  }
+  return hits;
+}
+
+__attribute__((target("avx512f")))
+uint32_t FindWithinDistanceAvx512(float position_x, float position_y, double reach,
+                                  const float* candidates_x, const float* candidates_y,
+                                  const double* candidate_radii, size_t num_of_candidates) {
+  const __m256i kLaneIndices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  __m256 point_x = _mm256_set1_ps(position_x);
+  __m256 point_y = _mm256_set1_ps(position_y);
+  __m512d wide_reach = _mm512_set1_pd(reach);
+
+  // Eight candidates at a time, since their differences are widened to
+  // doubles (the zero-masked conversions are used because the plain ones
+  // trip -Wuninitialized in some GCC versions)
+  uint32_t hits = 0;
+  for (size_t first = 0; first < num_of_candidates; first += 8) {
+    size_t num_left = num_of_candidates - first;
+    __mmask8 load_mask = __mmask8(num_left < 8 ? (1u << num_left) - 1 : 0xff);
+    __m256i float_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(num_left < 8 ? num_left : 8)),
+                                            kLaneIndices);
+    __m256 difference_x = _mm256_sub_ps(point_x, _mm256_maskload_ps(candidates_x + first, float_mask));
+    __m256 difference_y = _mm256_sub_ps(point_y, _mm256_maskload_ps(candidates_y + first, float_mask));
+
+    __m512d wide_x = _mm512_maskz_cvtps_pd(0xff, difference_x);
+    __m512d wide_y = _mm512_maskz_cvtps_pd(0xff, difference_y);
+    __m512d squared_distance = _mm512_add_pd(_mm512_mul_pd(wide_x, wide_x),
+                                             _mm512_mul_pd(wide_y, wide_y));
+    __m512d threshold = _mm512_add_pd(wide_reach,
+                                      _mm512_maskz_loadu_pd(load_mask, candidate_radii + first));
+    __mmask8 is_within = _mm512_mask_cmp_pd_mask(load_mask, squared_distance,
+                                                 _mm512_mul_pd(threshold, threshold), _CMP_LE_OQ);
+    hits |= uint32_t(is_within) << first;
+  }
+  return hits;
+}
+
+__attribute__((target("avx2")))
+uint32_t FindWithinDistanceSingleAvx2(float position_x, float position_y, float reach,
+                                      const float* candidates_x, const float* candidates_y,
+                                      const float* candidate_radii, size_t num_of_candidates) {
+  const __m256i kLaneIndices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  __m256 point_x = _mm256_set1_ps(position_x);
+  __m256 point_y = _mm256_set1_ps(position_y);
+  __m256 wide_reach = _mm256_set1_ps(reach);
+
+  uint32_t hits = 0;
+  for (size_t first = 0; first < num_of_candidates; first += 8) {
+    size_t num_left = num_of_candidates - first;
+    __m256i load_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(int(num_left < 8 ? num_left : 8)),
+                                           kLaneIndices);
+    __m256 difference_x = _mm256_sub_ps(point_x, _mm256_maskload_ps(candidates_x + first, load_mask));
+    __m256 difference_y = _mm256_sub_ps(point_y, _mm256_maskload_ps(candidates_y + first, load_mask));
+    __m256 squared_distance = _mm256_add_ps(_mm256_mul_ps(difference_x, difference_x),
+                                            _mm256_mul_ps(difference_y, difference_y));
+
+    __m256 threshold = _mm256_add_ps(wide_reach, _mm256_maskload_ps(candidate_radii + first, load_mask));
+    __m256 is_within = _mm256_cmp_ps(squared_distance, _mm256_mul_ps(threshold, threshold), _CMP_LE_OQ);
+    is_within = _mm256_and_ps(is_within, _mm256_castsi256_ps(load_mask));
+    hits |= uint32_t(_mm256_movemask_ps(is_within)) << first;
+  }
+  return hits;
+}
+
+__attribute__((target("avx512f")))
+uint32_t FindWithinDistanceSingleAvx512(float position_x, float position_y, float reach,
+                                        const float* candidates_x, const float* candidates_y,
+                                        const float* candidate_radii, size_t num_of_candidates) {
+  // Every candidate fits in one vector
+  __mmask16 load_mask = __mmask16((uint32_t(1) << num_of_candidates) - 1);
+  __m512 difference_x = _mm512_sub_ps(_mm512_set1_ps(position_x),
+                                      _mm512_maskz_loadu_ps(load_mask, candidates_x));
+  __m512 difference_y = _mm512_sub_ps(_mm512_set1_ps(position_y),
+                                      _mm512_maskz_loadu_ps(load_mask, candidates_y));
+  __m512 squared_distance = _mm512_add_ps(_mm512_mul_ps(difference_x, difference_x),
+                                          _mm512_mul_ps(difference_y, difference_y));
+
+  __m512 threshold = _mm512_add_ps(_mm512_set1_ps(reach),
+                                   _mm512_maskz_loadu_ps(load_mask, candidate_radii));
+  return uint32_t(_mm512_mask_cmp_ps_mask(load_mask, squared_distance,
+                                          _mm512_mul_ps(threshold, threshold), _CMP_LE_OQ));
+}
+#endif
+
+SimdLevel DetectSimdLevel() {
+#ifdef DISEASE_HAS_X86_KERNELS
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdLevel::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdLevel::kAvx2;
+  }
+#endif
+  return SimdLevel::kScalar;
+}
+
+}  // namespace
+
+SimdLevel GetSimdLevel() {
+  static const SimdLevel kSimdLevel = DetectSimdLevel();
+  return kSimdLevel;
+}
+
+uint32_t FindWithinDistance(float position_x, float position_y, double reach,
+                            const float* candidates_x, const float* candidates_y,
+                            const double* candidate_radii, size_t num_of_candidates) {
+  return FindWithinDistance(GetSimdLevel(), position_x, position_y, reach, candidates_x,
+                            candidates_y, candidate_radii, num_of_candidates);
+}
+
+uint32_t FindWithinDistance(SimdLevel level, float position_x, float position_y, double reach,
+                            const float* candidates_x, const float* candidates_y,
+                            const double* candidate_radii, size_t num_of_candidates) {
+  switch (level) {
+#ifdef DISEASE_HAS_X86_KERNELS
+    case SimdLevel::kAvx512:
+      return FindWithinDistanceAvx512(position_x, position_y, reach, candidates_x,
+                                      candidates_y, candidate_radii, num_of_candidates);
+    case SimdLevel::kAvx2:
+      return FindWithinDistanceAvx2(position_x, position_y, reach, candidates_x,
+                                    candidates_y, candidate_radii, num_of_candidates);
+#endif
+    default:
+      return FindWithinDistanceScalar(position_x, position_y, reach, candidates_x,
+                                      candidates_y, candidate_radii, num_of_candidates);
+  }
+}
+
+uint32_t FindWithinDistanceSingle(float position_x, float position_y, float reach,
+                                  const float* candidates_x, const float* candidates_y,
+                                  const float* candidate_radii, size_t num_of_candidates) {
+  return FindWithinDistanceSingle(GetSimdLevel(), position_x, position_y, reach, candidates_x,
+                                  candidates_y, candidate_radii, num_of_candidates);
+}
+
+uint32_t FindWithinDistanceSingle(SimdLevel level, float position_x, float position_y, float reach,
+                                  const float* candidates_x, const float* candidates_y,
+                                  const float* candidate_radii, size_t num_of_candidates) {
+  switch (level) {
+#ifdef DISEASE_HAS_X86_KERNELS
+    case SimdLevel::kAvx512:
+      return FindWithinDistanceSingleAvx512(position_x, position_y, reach, candidates_x,
+                                            candidates_y, candidate_radii, num_of_candidates);
+    case SimdLevel::kAvx2:
+      return FindWithinDistanceSingleAvx2(position_x, position_y, reach, candidates_x,
+                                          candidates_y, candidate_radii, num_of_candidates);
+#endif
+    default:
+      return FindWithinDistanceSingleScalar(position_x, position_y, reach, candidates_x,
+                                            candidates_y, candidate_radii, num_of_candidates);
+  }
+}
+
+}  // namespace disease
@@ -0,0 +1,131 @@
+#include "core/ensemble.h"
+
+#include "core/thread_pool.h"
+#include <algorithm>
+
+namespace disease {
+
+RunningStatistics& TickStatistics::operator[](Status status) {
+  return statistics[size_t(status)];
+}
+
+const RunningStatistics& TickStatistics::operator[](Status status) const {
+  return statistics[size_t(status)];
+}
+
+Ensemble::Ensemble(const Disease& disease)
+    : disease_(disease), num_of_threads_(1), num_of_replicates_(0) {
+  // Replicates run side by side rather than splitting each tick between threads
+  disease_.SetNumOfThreads(1);
+}
+
+void Ensemble::SetNumOfThreads(size_t num_of_threads) {
+  num_of_threads_ = std::max(num_of_threads, size_t(1));
+}
+
+size_t Ensemble::GetNumOfThreads() const {
+  return num_of_threads_;
+}
+
+void Ensemble::Run(size_t num_of_replicates, size_t num_of_ticks) {
+  size_t num_of_people = disease_.GetSusceptiblePopulationSize() + 1;
+
+  num_of_replicates_ = num_of_replicates;
+  tick_statistics_.assign(num_of_ticks + 1, TickStatistics());
+  for (TickStatistics& tick : tick_statistics_) {
+    for (RunningStatistics& statistics : tick.statistics) {
+      statistics = RunningStatistics(num_of_people);
+    }
+  }
+  peak_infectious_ = RunningStatistics(num_of_people);
+  time_to_peak_ = RunningStatistics(num_of_ticks);
+
+  auto run_replicate = [&](size_t replicate) {
+    vector<StatusCounts> status_counts(num_of_ticks + 1);
+    RunReplicate(replicate, status_counts);
+    AddReplicate(status_counts);
+  };
+
+  ThreadPool pool(num_of_threads_);
+  pool.ParallelForBalanced(num_of_replicates, run_replicate);
+}
+
+void Ensemble::RunReplicate(size_t replicate, vector<StatusCounts>& status_counts) const {
+  Disease replicate_disease = disease_;
+  replicate_disease.SetSeed(GetReplicateSeed(disease_.GetSeed(), replicate));
+  replicate_disease.SetPopulation(vector<Disease::Person>());
+  replicate_disease.CreatePopulation();
+
+  status_counts[0] = replicate_disease.GetStatusCounts();
+  for (size_t tick = 1; tick < status_counts.size(); tick++) {
+    replicate_disease.UpdateParticles();
+    status_counts[tick] = replicate_disease.GetStatusCounts();
+  }
+}
+
+void Ensemble::AddReplicate(const vector<StatusCounts>& status_counts) {
+  // The first tick with the most infectious people
+  size_t peak_tick = 0;
+  for (size_t tick = 1; tick < status_counts.size(); tick++) {
+    if (status_counts[tick].GetNumOfInfectious() > status_counts[peak_tick].GetNumOfInfectious()) {
+      peak_tick = tick;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(results_mutex_);
+  for (size_t tick = 0; tick < status_counts.size(); tick++) {
+    for (size_t status = 0; status < StatusCounts::kNumOfStatuses; status++) {
+      tick_statistics_[tick].statistics[status].Add(status_counts[tick].counts[status]);
+    }
+  }
+  peak_infectious_.Add(status_counts[peak_tick].GetNumOfInfectious());
+  time_to_peak_.Add(peak_tick);
+}
+
+void Ensemble::Write(std::ostream& output) const {
+  const char* status_names[StatusCounts::kNumOfStatuses] = {
+      "susceptible", "symptomatic", "asymptomatic", "removed"};
+
+  output << "tick";
+  for (const char* name : status_names) {
+    output << ',' << name << "_mean," << name << "_sd," << name << "_p5,"
+           << name << "_p50," << name << "_p95";
+  }
+  output << '\n';
+
+  for (size_t tick = 0; tick < tick_statistics_.size(); tick++) {
+    output << tick;
+    for (const RunningStatistics& statistics : tick_statistics_[tick].statistics) {
+      output << ',' << statistics.GetMean() << ',' << statistics.GetStandardDeviation()
+             << ',' << statistics.GetQuantile(0.05) << ',' << statistics.GetQuantile(0.5)
+             << ',' << statistics.GetQuantile(0.95);
+    }
+    output << '\n';
+  }
+}
+
+uint64_t Ensemble::GetReplicateSeed(uint64_t base_seed, size_t replicate) {
+  // SplitMix64, so neighboring replicates get unrelated seeds
+  uint64_t seed = base_seed + (uint64_t(replicate) + 1) * 0x9e3779b97f4a7c15ULL;
+  seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+  return seed ^ (seed >> 31);
+}
+
+size_t Ensemble::GetNumOfReplicates() const {
+  return num_of_replicates_;
+}
+
+const vector<TickStatistics>& Ensemble::GetTickStatistics() const {
+  return tick_statistics_;
+}
+
+const RunningStatistics& Ensemble::GetPeakInfectious() const {
+  return peak_infectious_;
+}
+
+const RunningStatistics& Ensemble::GetTimeToPeak() const {
+  return time_to_peak_;
+}
+
+}  // namespace disease
@@ -1,26 +1,38 @@
 #include "core/infectious_disease.h"
 
+#include <algorithm>
+#include <glm/geometric.hpp>
+
 namespace disease {
 
+namespace {
+
+// Positions are scaled to 16 bits in each direction for their Morton codes
+const float kMortonCoordinateMax = 65535;
+
+/*
+ * Spreads the low 16 bits of a value out to the even bits, so that two
+ * coordinates can be interleaved into a Morton code.
+ */
+uint32_t SpreadBits(uint32_t value) {
+  value &= 0xffff;
+  value = (value | value << 8) & 0x00ff00ff;
+  value = (value | value << 4) & 0x0f0f0f0f;
+  value = (value | value << 2) & 0x33333333;
+  value = (value | value << 1) & 0x55555555;
+  return value;
+}
+
+}  // namespace
+
 Disease::Disease(double left_margin, double top_margin,
                  double container_height, double container_width,
                  const vec2& quarantine_top_left, const vec2& quarantine_bottom_right,
                  const vec2& location_top_left, const vec2& location_bottom_right) {
   // Initialize container values
-  left_wall_ = left_margin;
-  top_wall_ = top_margin;
-  bottom_wall_ = top_wall_ + container_height;
-  right_wall_ = left_wall_ + container_width;
-
-  quarantine_left_wall_ = quarantine_top_left.x;
-  quarantine_top_wall_ = quarantine_top_left.y;
-  quarantine_right_wall_ = quarantine_bottom_right.x;
-  quarantine_bottom_wall_ = quarantine_bottom_right.y;
-
-  location_left_wall_ = location_top_left.x;
-  location_top_wall_ = location_top_left.y;
-  location_right_wall_ = location_bottom_right.x;
-  location_bottom_wall_ = location_bottom_right.y;
+  SetContainerBounds(left_margin, top_margin, container_height, container_width);
+  SetQuarantineBounds(quarantine_top_left, quarantine_bottom_right);
+  SetLocationBounds(location_top_left, location_bottom_right);
 
   // Initialize feature values
   should_quarantine_ = false;
@@ -29,6 +41,12 @@ Disease::Disease(double left_margin, double top_margin,
   percent_performing_social_distance_ = 0;
   radius_of_infection_ = kInfectionRadius;
   have_central_location_ = false;
+  susceptible_population_size_ = kSusceptiblePopulation;
+  particle_radius_ = kRadius;
+  num_of_ticks_ = 0;
+  should_update_in_two_phases_ = false;
+  precision_ = Precision::kDouble;
+  reorder_interval_ = 0;
 
   // Initialize booleans
   is_infection_determination_random_ = true;
@@ -48,20 +66,9 @@ Disease::Disease(double left_margin, double top_margin,
                  bool is_new_distancing_velocity_random, bool is_going_to_loc_random,
                  bool is_leaving_loc_random, bool is_below_threshold) {
   // Initialize container values
-  left_wall_ = left_margin;
-  top_wall_ = top_margin;
-  bottom_wall_ = top_wall_ + container_height;
-  right_wall_ = left_wall_ + container_width;
-
-  quarantine_left_wall_ = quarantine_top_left.x;
-  quarantine_top_wall_ = quarantine_top_left.y;
-  quarantine_right_wall_ = quarantine_bottom_right.x;
-  quarantine_bottom_wall_ = quarantine_bottom_right.y;
-
-  location_left_wall_ = location_top_left.x;
-  location_top_wall_ = location_top_left.y;
-  location_right_wall_ = location_bottom_right.x;
-  location_bottom_wall_ = location_bottom_right.y;
+  SetContainerBounds(left_margin, top_margin, container_height, container_width);
+  SetQuarantineBounds(quarantine_top_left, quarantine_bottom_right);
+  SetLocationBounds(location_top_left, location_bottom_right);
 
   // Initialize feature values
   should_quarantine_ = false;
@@ -70,6 +77,12 @@ Disease::Disease(double left_margin, double top_margin,
   percent_performing_social_distance_ = 0;
   radius_of_infection_ = kInfectionRadius;
   have_central_location_ = false;
+  susceptible_population_size_ = kSusceptiblePopulation;
+  particle_radius_ = kRadius;
+  num_of_ticks_ = 0;
+  should_update_in_two_phases_ = false;
+  precision_ = Precision::kDouble;
+  reorder_interval_ = 0;
 
   // Initialize booleans
   is_infection_determination_random_ = is_infection_determination_random;
@@ -82,7 +95,12 @@ Disease::Disease(double left_margin, double top_margin,
 
 // Setters and Getters
 void Disease::SetPopulation(const vector<Disease::Person>& population_to_set_to) {
-  population_ = population_to_set_to;
+  population_.Clear();
+  population_.Reserve(population_to_set_to.size());
+  for (const Disease::Person& person : population_to_set_to) {
+    population_.Add(person);
+  }
+  CountStatuses();
 }
 
 void Disease::SetShouldQuarantine(bool should_quarantine) {
@@ -108,10 +126,92 @@ void Disease::SetHaveCentralLocation(bool have_central_location) {
   have_central_location_ = have_central_location;
 }
 
-const vector<Disease::Person>& Disease::GetPopulation() {
+void Disease::SetSusceptiblePopulationSize(size_t susceptible_population_size) {
+  susceptible_population_size_ = susceptible_population_size;
+}
+
+void Disease::SetParticleRadius(double particle_radius) {
+  particle_radius_ = particle_radius;
+}
+
+void Disease::SetContainerBounds(double left_margin, double top_margin,
+                                 double container_height, double container_width) {
+  left_wall_ = left_margin;
+  top_wall_ = top_margin;
+  bottom_wall_ = top_wall_ + container_height;
+  right_wall_ = left_wall_ + container_width;
+}
+
+void Disease::SetQuarantineBounds(const vec2& quarantine_top_left, const vec2& quarantine_bottom_right) {
+  quarantine_left_wall_ = quarantine_top_left.x;
+  quarantine_top_wall_ = quarantine_top_left.y;
+  quarantine_right_wall_ = quarantine_bottom_right.x;
+  quarantine_bottom_wall_ = quarantine_bottom_right.y;
+}
+
+void Disease::SetLocationBounds(const vec2& location_top_left, const vec2& location_bottom_right) {
+  location_left_wall_ = location_top_left.x;
+  location_top_wall_ = location_top_left.y;
+  location_right_wall_ = location_bottom_right.x;
+  location_bottom_wall_ = location_bottom_right.y;
+}
+
+void Disease::SetSeed(uint64_t seed) {
+  random_.SetSeed(seed);
+}
+
+void Disease::SetShouldUpdateInTwoPhases(bool should_update_in_two_phases) {
+  should_update_in_two_phases_ = should_update_in_two_phases;
+}
+
+void Disease::SetPrecision(Precision precision) {
+  precision_ = precision;
+}
+
+void Disease::SetReorderInterval(size_t reorder_interval) {
+  reorder_interval_ = reorder_interval;
+}
+
+void Disease::SetNumOfThreads(size_t num_of_threads) {
+  if (num_of_threads == GetNumOfThreads()) {
+    return;
+  }
+
+  if (num_of_threads <= 1) {
+    thread_pool_.reset();
+  } else {
+    thread_pool_ = std::make_shared<ThreadPool>(num_of_threads);
+  }
+}
+
+vector<Disease::Person> Disease::GetPopulation() const {
+  return population_.ToVector();
+}
+
+Disease::Person Disease::GetPersonById(uint32_t person_id) const {
+  return population_.GetPerson(population_.GetIndex(person_id));
+}
+
+size_t Disease::GetIndexOfId(uint32_t person_id) const {
+  return population_.GetIndex(person_id);
+}
+
+const Population& Disease::GetPopulationData() const {
   return population_;
 }
 
+const StatusCounts& Disease::GetStatusCounts() const {
+  return status_counts_;
+}
+
+const StatusTransitions& Disease::GetStatusTransitions() const {
+  return status_transitions_;
+}
+
+const TickProfiler& Disease::GetTickProfiler() const {
+  return tick_profiler_;
+}
+
 bool Disease::GetShouldQuarantineValue() const {
   return should_quarantine_;
 }
@@ -136,6 +236,42 @@ bool Disease::GetHaveCentralLocation() const {
   return have_central_location_;
 }
 
+size_t Disease::GetSusceptiblePopulationSize() const {
+  return susceptible_population_size_;
+}
+
+double Disease::GetParticleRadius() const {
+  return particle_radius_;
+}
+
+vec2 Disease::GetContainerTopLeft() const {
+  return vec2(left_wall_, top_wall_);
+}
+
+vec2 Disease::GetContainerBottomRight() const {
+  return vec2(right_wall_, bottom_wall_);
+}
+
+uint64_t Disease::GetSeed() const {
+  return random_.GetSeed();
+}
+
+bool Disease::GetShouldUpdateInTwoPhases() const {
+  return should_update_in_two_phases_;
+}
+
+size_t Disease::GetNumOfThreads() const {
+  return thread_pool_ ? thread_pool_->GetNumOfThreads() : 1;
+}
+
+Disease::Precision Disease::GetPrecision() const {
+  return precision_;
+}
+
+size_t Disease::GetReorderInterval() const {
+  return reorder_interval_;
+}
+
 size_t Disease::GetMinimumExposureTime() const {
   return kMinimumExposureTime;
 }
@@ -172,33 +308,90 @@ size_t Disease::GetMaximumInfectionRadius() const {
   return kMaximumInfectionRadius;
 }
 
+size_t Disease::GetFeatureIncrement() const {
+  return kFeatureIncrement;
+}
+
+size_t Disease::GetMinimumAllowedRadius(size_t percent_performing_social_distance) const {
+  if (percent_performing_social_distance == 0) {
+    return kMinimumInfectionRadius;
+  }
+  return std::max(size_t(kMinimumInfectionRadius), kAmountOfSocialDistance + kFeatureIncrement);
+}
+
 void Disease::CreatePopulation() {
   // Add people to population if there isn't anybody in the population
-  if (population_.size() == 0) {
-    for (size_t i = 0; i < kSusceptiblePopulation; i++) {
-      population_.push_back(CreatePerson());
+  if (population_.IsEmpty()) {
+    ReserveBuffers(susceptible_population_size_ + 1);
+    for (size_t i = 0; i < susceptible_population_size_; i++) {
+      population_.Add(CreatePerson(population_.Size()));
     }
-    population_.push_back(CreatePatientZero());
+    population_.Add(CreatePatientZero(population_.Size()));
 
     // Determine people social distancing
     double social_distancing_percentage = double(percent_performing_social_distance_) / kOneHundred;
-    for (size_t person = 0; person < size_t(social_distancing_percentage * population_.size()); person++) {
-      population_[person].is_social_distancing = true;
+    for (size_t person = 0; person < size_t(social_distancing_percentage * population_.Size()); person++) {
+      population_.is_social_distancing[person] = true;
     }
+
+    CountStatuses();
+    tick_profiler_.Clear();
   }
 }
 
-Disease::Person Disease::CreatePerson() {
+void Disease::ReserveBuffers(size_t num_of_people) {
+  population_.Reserve(num_of_people);
+  status_transitions_.Reset(num_of_people);
+  neighbor_grid_.Reserve(num_of_people);
+  reorder_keys_.reserve(num_of_people);
+  reorder_order_.reserve(num_of_people);
+}
+
+void Disease::ReorderPopulation() {
+  size_t num_of_people = population_.Size();
+  if (num_of_people == 0) {
+    return;
+  }
+
+  // Scale everyone's position (some may be in the quarantine box, outside of
+  // the container) to between 0 and kMortonCoordinateMax in both directions
+  auto x_bounds = std::minmax_element(population_.position_x.begin(), population_.position_x.end());
+  auto y_bounds = std::minmax_element(population_.position_y.begin(), population_.position_y.end());
+  float left = *x_bounds.first;
+  float top = *y_bounds.first;
+  float scale_x = kMortonCoordinateMax / std::max(*x_bounds.second - left, 1.0f);
+  float scale_y = kMortonCoordinateMax / std::max(*y_bounds.second - top, 1.0f);
+
+  reorder_keys_.resize(num_of_people);
+  for (size_t index = 0; index < num_of_people; index++) {
+    uint32_t column = uint32_t((population_.position_x[index] - left) * scale_x);
+    uint32_t row = uint32_t((population_.position_y[index] - top) * scale_y);
+    uint64_t morton_code = SpreadBits(column) | SpreadBits(row) << 1;
+    reorder_keys_[index] = morton_code << 32 | index;
+  }
+  std::sort(reorder_keys_.begin(), reorder_keys_.end());
+
+  reorder_order_.resize(num_of_people);
+  for (size_t index = 0; index < num_of_people; index++) {
+    reorder_order_[index] = size_t(reorder_keys_[index] & 0xffffffff);
+  }
+  population_.Reorder(reorder_order_);
+}
+
+Disease::Person Disease::CreatePerson(size_t index) {
   Disease::Person new_person;
 
-  new_person.radius = kRadius;
+  new_person.radius = particle_radius_;
 
-  new_person.position = vec2(ci::randFloat(left_wall_, right_wall_),
-                             ci::randFloat(top_wall_, bottom_wall_));
+  // The person's id is the index they're added at
+  uint32_t id = uint32_t(index);
+  new_person.position = vec2(RandomFloat(id, RandomDraw::kPositionX, left_wall_, right_wall_),
+                             RandomFloat(id, RandomDraw::kPositionY, top_wall_, bottom_wall_));
 
-  new_person.velocity = vec2(ci::randFloat(-1,1), ci::randFloat(-1,1));
+  new_person.velocity = vec2(RandomFloat(id, RandomDraw::kVelocityX, -1, 1),
+                             RandomFloat(id, RandomDraw::kVelocityY, -1, 1));
   new_person.status = Status::kSusceptible;
-  new_person.color = vec3(0,0,1);
+  new_person.color = GetStatusColor(Status::kSusceptible);
   new_person.continuous_exposure_time = 0;
   new_person.time_infected = 0;
   new_person.has_been_exposed_in_frame = false;
@@ -210,111 +403,211 @@ Disease::Person Disease::CreatePerson() {
   return new_person;
 }
 
-Disease::Person Disease::CreatePatientZero() {
-  Disease::Person infected_person = CreatePerson();
+Disease::Person Disease::CreatePatientZero(size_t index) {
+  Disease::Person infected_person = CreatePerson(index);
 
   infected_person.status = Status::kSymptomatic;
-  infected_person.color = vec3(1,0,0);
+  infected_person.color = GetStatusColor(Status::kSymptomatic);
 
   return infected_person;
 }
 
 void Disease::UpdateParticles() {
-  ResetFrame();
+  if (TickProfiler::kIsEnabled) {
+    tick_profiler_.StartTick();
+  }
 
-  for (size_t current = 0; current < population_.size(); current++) {
+  {
+    DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kTick);
+    num_of_ticks_++;
+    if (reorder_interval_ != 0 && num_of_ticks_ % reorder_interval_ == 0) {
+      DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kReorder);
+      ReorderPopulation();
+    }
+    ResetFrame();
+
+    if (should_update_in_two_phases_) {
+      UpdateParticlesInTwoPhases();
+
+      // The changes were recorded in whatever order the threads made them
+      status_transitions_.SortByIndex();
+    } else {
+      for (size_t current = 0; current < population_.Size(); current++) {
+        UpdatePerson(current);
+      }
+    }
+
+    status_transitions_.ApplyTo(status_counts_);
+  }
+
+  if (TickProfiler::kIsEnabled) {
+    tick_profiler_.EndTick();
+  }
+}
+
+void Disease::UpdatePerson(size_t current) {
+  {
     // Update Health Status
-    population_[current] = UpdatePersonStatus(population_[current], current);
+    DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kStatusUpdate);
+    UpdatePersonStatus(current);
+  }
 
+  {
     // Update Central Location Status
+    DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kCentralLocation);
     DetermineCentralLocationStatus(current);
+  }
 
+  {
     // Check for wall collisions
+    DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kWallCollisions);
     CheckForAllWallCollisions(current);
+  }
 
-    // Check if the person should be quarantined
-    if (ShouldBeQuarantined(population_[current])) {
-      if (should_quarantine_ && !population_[current].is_going_to_central_location) {
-        population_[current] = QuarantinePerson(population_[current]);
-        population_[current].is_at_central_location = false;
-      }
-    } else {
-      // Update position
-      UpdatePosition(current);
+  // Check if the person should be quarantined
+  DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kMovement);
+  if (ShouldBeQuarantined(current)) {
+    if (should_quarantine_ && !population_.is_going_to_central_location[current]) {
+      QuarantinePerson(current);
+      population_.is_at_central_location[current] = false;
     }
+  } else {
+    // Update position
+    UpdatePosition(current);
+  }
+}
+
+void Disease::UpdateParticlesInTwoPhases() {
+  // Nobody moves or changes status until everyone's interactions are found
+  auto find_interactions = [this](size_t current) { FindInteractions(current); };
+  ForEachPerson(find_interactions);
+
+  auto update_person = [this](size_t current) { UpdatePerson(current); };
+  ForEachPerson(update_person);
+}
+
+void Disease::FindInteractions(size_t current_index) {
+  DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kFindInteractions);
+  bool is_susceptible = population_.status[current_index] == Status::kSusceptible;
+  bool is_social_distancing = population_.is_social_distancing[current_index];
+
+  if (!is_susceptible && !is_social_distancing) {
+    return;
+  }
+
+  if (is_susceptible) {
+    ForEachWithinDistance(current_index, double(radius_of_infection_), [&](size_t other) {
+      if (population_.status[other] == Status::kSymptomatic ||
+          population_.status[other] == Status::kAsymptomatic) {
+        population_.has_been_exposed_in_frame[current_index] = true;
+        return false;
+      }
+      return true;
+    });
+  }
+
+  if (is_social_distancing) {
+    ForEachWithinDistance(current_index, double(kAmountOfSocialDistance), [&](size_t other) {
+      if (other != current_index) {
+        SavePositionRelativeToCurrentPerson(current_index, other);
+      }
+      return true;
+    });
   }
 }
 
 void Disease::ResetFrame() {
-  for (size_t current = 0; current < population_.size(); current++) {
-    population_[current].has_been_exposed_in_frame = false;
-    population_[current].positions_of_people_in_bubble.clear();
+  DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kResetFrame);
+  double largest_radius = 0;
+  status_transitions_.Reset(population_.Size());
+
+  for (size_t current = 0; current < population_.Size(); current++) {
+    population_.has_been_exposed_in_frame[current] = false;
+    population_.positions_of_people_in_bubble[current].Clear();
+
+    largest_radius = std::max(largest_radius, population_.radius[current]);
+  }
+
+  // A cell has to be wide enough that anyone close enough to infect someone,
+  // or to be in their social distancing bubble, is in a neighboring cell
+  double interaction_distance = std::max(double(radius_of_infection_),
+                                         double(kAmountOfSocialDistance));
+  neighbor_grid_.Rebuild(population_.position_x, population_.position_y, population_.radius,
+                         2 * largest_radius + interaction_distance);
+}
+
+void Disease::CountStatuses() {
+  status_counts_.Clear();
+  for (Status status : population_.status) {
+    status_counts_[status]++;
   }
 }
 
-Disease::Person Disease::UpdatePersonStatus(const Person& current_person, size_t current_index) {
-  Person patient = current_person;
+void Disease::ChangeStatus(size_t current_index, Status status) {
+  status_transitions_.Record(current_index, population_.id[current_index],
+                             population_.status[current_index], status);
+  population_.status[current_index] = status;
+  population_.color[current_index] = GetStatusColor(status);
+}
+
+void Disease::UpdatePersonStatus(size_t current_index) {
+  Status status = population_.status[current_index];
 
-  if (patient.status == Status::kSusceptible) {
+  if (status == Status::kSusceptible) {
     // Update the susceptible person's exposure time
-    patient = UpdateExposureTime(current_person, current_index);
+    UpdateExposureTime(current_index);
 
-    if (patient.continuous_exposure_time == exposure_time_to_be_infected_) {
-      patient = DetermineInfectionStatus(current_person);
-      patient.continuous_exposure_time = 0;
+    if (population_.continuous_exposure_time[current_index] == exposure_time_to_be_infected_) {
+      DetermineInfectionStatus(current_index);
+      population_.continuous_exposure_time[current_index] = 0;
     }
-  } else if (patient.status == Status::kSymptomatic || patient.status == Status::kAsymptomatic) {
-    ExposeOthers(current_person, current_index);
-
-    patient.time_infected++;
-    if (patient.time_infected == infected_time_to_be_removed_) {
-      patient.status = Status::kRemoved;
-      patient.color = vec3(0.5, 0.5, 0.5);
-      patient.time_infected = 0;
+  } else if (status == Status::kSymptomatic || status == Status::kAsymptomatic) {
+    // In two phases, the people exposed have already been found
+    if (!should_update_in_two_phases_) {
+      ExposeOthers(current_index);
     }
-  }
 
-  return patient;
+    size_t& time_infected = population_.time_infected[current_index];
+    time_infected++;
+    if (time_infected == infected_time_to_be_removed_) {
+      ChangeStatus(current_index, Status::kRemoved);
+      time_infected = 0;
+    }
+  }
 }
 
-Disease::Person Disease::UpdateExposureTime(const Disease::Person& current_person, size_t current_index) {
-  Disease::Person patient = current_person;
+void Disease::UpdateExposureTime(size_t current_index) {
+  size_t& continuous_exposure_time = population_.continuous_exposure_time[current_index];
 
   // Check if the current particle has already been
   // infected by a particle that's been updated already
-  if (patient.has_been_exposed_in_frame) {
-    patient.continuous_exposure_time++;
-  } else if (WithinInfectionRadiusOfOthers(patient, current_index)) {
+  if (population_.has_been_exposed_in_frame[current_index]) {
+    continuous_exposure_time++;
+  } else if (!should_update_in_two_phases_ && WithinInfectionRadiusOfOthers(current_index)) {
     // Check if the current particle will get
     // infected by particles that aren't updated yet
-    patient.continuous_exposure_time++;
+    continuous_exposure_time++;
   } else {
-    patient.continuous_exposure_time = 0;
+    continuous_exposure_time = 0;
   }
-
-  return patient;
 }
 
-bool Disease::WithinInfectionRadiusOfOthers(const Disease::Person& current_person,
-                                            size_t current_index) const {
-  for (size_t other = current_index + 1; other < population_.size(); other++) {
-    Disease::Person other_person = population_[other];
+bool Disease::WithinInfectionRadiusOfOthers(size_t current_index) const {
+  // Only people who haven't been updated yet in this frame are checked, and
+  // they haven't moved since the grid was built
+  bool checked_everyone = ForEachWithinDistance(
+      current_index, double(radius_of_infection_), [&](size_t other) {
+        return other <= current_index ||
+               (population_.status[other] != Status::kSymptomatic &&
+                population_.status[other] != Status::kAsymptomatic);
+      });
 
-    if (other_person.status == Status::kSymptomatic ||
-        other_person.status == Status::kAsymptomatic) {
-      if (WithinOneInfectionRadius(current_person, other_person)) {
-        return true;
-      }
-    }
-  }
-
-  return false;
+  return !checked_everyone;
 }
 
-Disease::Person Disease::DetermineInfectionStatus(const Person& current_person) const {
-  Person patient = current_person;
-
-  double value_to_determine_infection_status = ci::randFloat(0,1);
+void Disease::DetermineInfectionStatus(size_t current_index) {
+  double value_to_determine_infection_status =
+      RandomFloat(population_.id[current_index], RandomDraw::kInfectionStatus, 0, 1);
 
   // Following conditional section is mainly used for testing
   if (!is_infection_determination_random_) {
@@ -326,43 +619,27 @@ Disease::Person Disease::DetermineInfectionStatus(const Person& current_person)
   }
 
   if (value_to_determine_infection_status <= kProbabilityOfBeingAsymptomatic) {
-    patient.status = Status::kAsymptomatic;
-    patient.color = vec3(1, 1, 0);
+    ChangeStatus(current_index, Status::kAsymptomatic);
   } else {
-    patient.status = Status::kSymptomatic;
-    patient.color = vec3(1, 0, 0);
+    ChangeStatus(current_index, Status::kSymptomatic);
   }
-
-  return patient;
 }
 
-void Disease::ExposeOthers(const Disease::Person& current_person, size_t current_index) {
-  for (size_t other = current_index + 1; other < population_.size(); other++) {
-    if (population_[other].status == Status::kSusceptible) {
-      if (WithinOneInfectionRadius(current_person, population_[other])) {
-        population_[other].has_been_exposed_in_frame = true;
-      }
+void Disease::ExposeOthers(size_t current_index) {
+  // The people exposed haven't been updated (or moved) yet in this frame
+  ForEachWithinDistance(current_index, double(radius_of_infection_), [&](size_t other) {
+    if (other > current_index && population_.status[other] == Status::kSusceptible) {
+      population_.has_been_exposed_in_frame[other] = true;
     }
-  }
-}
-
-bool Disease::WithinOneInfectionRadius(const Disease::Person& current_person, const Disease::Person& other_person) const {
-  // Calculate distance between center of particles
-  double position_x_val_difference = current_person.position.x - other_person.position.x;
-  double position_y_val_difference = current_person.position.y - other_person.position.y;
-  double sum_of_squared_differences = (position_x_val_difference * position_x_val_difference) +
-                                      (position_y_val_difference * position_y_val_difference);
-  double distance_between_centers = sqrt(sum_of_squared_differences);
-
-  return (distance_between_centers <= (current_person.radius + other_person.radius + kInfectionRadius));
+    return true;
+  });
 }
 
-
 void Disease::DetermineCentralLocationStatus(size_t current) {
-  if (have_central_location_ && !population_[current].is_quarantined) {
-    if (population_[current].is_at_central_location) {
+  if (have_central_location_ && !population_.is_quarantined[current]) {
+    if (population_.is_at_central_location[current]) {
       DetermineIfPersonLeavesCentralLocation(current);
-    } else if (population_[current].is_going_to_central_location) {
+    } else if (population_.is_going_to_central_location[current]) {
       DetermineIfPersonArrivesAtCentralLocation(current);
     } else {
       DetermineIfPersonGoesToCentralLocation(current);
@@ -371,7 +648,7 @@ void Disease::DetermineCentralLocationStatus(size_t current) {
 }
 
 void Disease::DetermineIfPersonLeavesCentralLocation(size_t current) {
-  double probability = ci::randFloat(0,1);
+  double probability = RandomFloat(population_.id[current], RandomDraw::kLeavingLocation, 0, 1);
 
   // Following conditional section is mainly used for testing
   if (!is_leaving_loc_random_) {
@@ -383,30 +660,32 @@ void Disease::DetermineIfPersonLeavesCentralLocation(size_t current) {
   }
 
   if (probability <= kProbabilityOfLeavingLocation) {
-    population_[current].is_at_central_location = false;
-    population_[current].is_going_to_central_location = false;
+    population_.is_at_central_location[current] = false;
+    population_.is_going_to_central_location[current] = false;
   }
 }
 
 void Disease::DetermineIfPersonArrivesAtCentralLocation(size_t current) {
   // Move person to central location--wouldn't use if I
   // were to visually show the particle moving there
-  double new_x_position = ci::randFloat(location_left_wall_, location_right_wall_);
-  double new_y_position = ci::randFloat(location_top_wall_, location_bottom_wall_);
-  population_[current].position = vec2(new_x_position, new_y_position);
+  double new_x_position = RandomFloat(population_.id[current], RandomDraw::kLocationPositionX,
+                                      location_left_wall_, location_right_wall_);
+  double new_y_position = RandomFloat(population_.id[current], RandomDraw::kLocationPositionY,
+                                      location_top_wall_, location_bottom_wall_);
+  population_.SetPosition(current, vec2(new_x_position, new_y_position));
 
   // Check if person is at location yet
-  if (population_[current].position.x >= location_left_wall_ &&
-      population_[current].position.x <= location_right_wall_ &&
-      population_[current].position.y >= location_top_wall_ &&
-      population_[current].position.y <= location_bottom_wall_) {
-    population_[current].is_going_to_central_location = false;
-    population_[current].is_at_central_location = true;
+  if (population_.position_x[current] >= location_left_wall_ &&
+      population_.position_x[current] <= location_right_wall_ &&
+      population_.position_y[current] >= location_top_wall_ &&
+      population_.position_y[current] <= location_bottom_wall_) {
+    population_.is_going_to_central_location[current] = false;
+    population_.is_at_central_location[current] = true;
   }
 }
 
 void Disease::DetermineIfPersonGoesToCentralLocation(size_t current) {
-  double probability = ci::randFloat(0,1);
+  double probability = RandomFloat(population_.id[current], RandomDraw::kGoingToLocation, 0, 1);
 
   // Following conditional section is mainly used for testing
   if (!is_going_to_loc_random_) {
@@ -418,7 +697,7 @@ void Disease::DetermineIfPersonGoesToCentralLocation(size_t current) {
   }
 
   if (probability <= kProbabilityOfGoingToLocation) {
-    population_[current].is_going_to_central_location = true;
+    population_.is_going_to_central_location[current] = true;
 
     // TODO: Visualize the particle moving to the new location instead of
     //  immediately moving it there (would need to adjust particle velocity
@@ -427,13 +706,13 @@ void Disease::DetermineIfPersonGoesToCentralLocation(size_t current) {
 }
 
 void Disease::CheckForAllWallCollisions(size_t current) {
-  if (population_[current].is_quarantined) {
+  if (population_.is_quarantined[current]) {
     if (should_quarantine_) {
       // Check for collision with quarantine box walls
       CheckForWallCollisions(current, quarantine_left_wall_, quarantine_top_wall_,
                              quarantine_right_wall_, quarantine_bottom_wall_, false);
     }
-  } else if (population_[current].is_at_central_location) {
+  } else if (population_.is_at_central_location[current]) {
     // Check for collision with inside of central location walls
     if (have_central_location_) {
       CheckForWallCollisions(current, location_left_wall_, location_top_wall_,
@@ -455,46 +734,42 @@ void Disease::CheckForWallCollisions(size_t current, double left_bound, double t
                                      double right_bound, double bottom_bound,
                                      bool is_outside_collision) {
   // Check for collisions with horizontal walls
-  if (HasCollidedWithWall(population_[current], top_bound, true, true,
+  if (HasCollidedWithWall(current, top_bound, true, true,
                           left_bound, right_bound, is_outside_collision) ||
-      HasCollidedWithWall(population_[current], bottom_bound, true, false,
+      HasCollidedWithWall(current, bottom_bound, true, false,
                           left_bound, right_bound, is_outside_collision)) {
-    vec2 new_velocity = vec2(population_[current].velocity.x,
-                             -population_[current].velocity.y);
-    population_[current].velocity = new_velocity;
+    population_.velocity_y[current] = -population_.velocity_y[current];
   }
 
   // Check for collisions with vertical walls
-  if (HasCollidedWithWall(population_[current], left_bound, false, true,
+  if (HasCollidedWithWall(current, left_bound, false, true,
                           top_bound, bottom_bound, is_outside_collision) ||
-      HasCollidedWithWall(population_[current], right_bound, false, false,
+      HasCollidedWithWall(current, right_bound, false, false,
                           top_bound, bottom_bound, is_outside_collision)) {
-    vec2 new_velocity = vec2(-population_[current].velocity.x,
-                             population_[current].velocity.y);
-    population_[current].velocity = new_velocity;
+    population_.velocity_x[current] = -population_.velocity_x[current];
   }
 }
 
-bool Disease::HasCollidedWithWall(const Disease::Person& current_particle,
+bool Disease::HasCollidedWithWall(size_t current,
                                   double wall_boundary,
                                   bool is_horizontal_wall, bool is_lower_bound,
                                   double perpendicular_lower_bound,
                                   double perpendicular_upper_bound,
                                   bool is_outside_collision) const {
-  double particle_position_component_different = current_particle.position.x;
+  double particle_position_component_different = population_.position_x[current];
   if (is_horizontal_wall) {
-    particle_position_component_different = current_particle.position.y;
+    particle_position_component_different = population_.position_y[current];
   }
 
   // Checks if the particle and wall are touching
-  if (abs(particle_position_component_different - wall_boundary) <= current_particle.radius) {
-    vec2 wall_position = vec2(wall_boundary, current_particle.position.y);
+  if (std::abs(particle_position_component_different - wall_boundary) <= population_.radius[current]) {
+    vec2 wall_position = vec2(wall_boundary, population_.position_y[current]);
     if (is_horizontal_wall) {
-      wall_position = vec2(current_particle.position.x, wall_boundary);
+      wall_position = vec2(population_.position_x[current], wall_boundary);
     }
 
     // Checks if the particle is moving towards the wall
-    if (IsMovingTowardsWall(current_particle, wall_position,
+    if (IsMovingTowardsWall(current, wall_position,
                             is_horizontal_wall, is_lower_bound,
                             perpendicular_lower_bound,
                             perpendicular_upper_bound,
@@ -505,17 +780,17 @@ bool Disease::HasCollidedWithWall(const Disease::Person& current_particle,
   return false;
 }
 
-bool Disease::IsMovingTowardsWall(const Disease::Person& current_particle,
+bool Disease::IsMovingTowardsWall(size_t current,
                                   const vec2& wall_position, bool is_horizontal,
                                   bool is_lower_bound, double perpendicular_lower_bound,
                                   double perpendicular_upper_bound, bool is_outside_collision) const {
-  vec2 velocity_difference = current_particle.velocity;
-  vec2 position_difference = current_particle.position - wall_position;
+  vec2 velocity_difference = population_.GetVelocity(current);
+  vec2 position_difference = population_.GetPosition(current) - wall_position;
 
   // Check if moving towards each other
   if (dot(velocity_difference, position_difference) < 0) {
-    if (is_outside_collision && !current_particle.is_going_to_central_location) {
-      if (IsMovingTowardsWallOnOutside(current_particle, wall_position,
+    if (is_outside_collision && !population_.is_going_to_central_location[current]) {
+      if (IsMovingTowardsWallOnOutside(current, wall_position,
                                        is_horizontal, is_lower_bound,
                                        perpendicular_lower_bound,
                                        perpendicular_upper_bound)) {
@@ -528,33 +803,33 @@ bool Disease::IsMovingTowardsWall(const Disease::Person& current_particle,
   return false;
 }
 
-bool Disease::IsMovingTowardsWallOnOutside(const Disease::Person& current_particle,
+bool Disease::IsMovingTowardsWallOnOutside(size_t current,
                                            const vec2& wall_position,
                                            bool is_horizontal, bool is_lower_bound,
                                            double perpendicular_lower_bound,
                                            double perpendicular_upper_bound) const {
   // Check it's moving towards the proper side
   if (is_lower_bound) {
-    if (is_horizontal && current_particle.velocity.y < 0 &&
-        current_particle.position.x > perpendicular_upper_bound &&
-        current_particle.position.x < perpendicular_lower_bound) {
+    if (is_horizontal && population_.velocity_y[current] < 0 &&
+        population_.position_x[current] > perpendicular_upper_bound &&
+        population_.position_x[current] < perpendicular_lower_bound) {
       // i.e. if the wall is the bottom side of the container
       return true;
-    } else if (!is_horizontal && current_particle.velocity.x < 0 &&
-               current_particle.position.y > perpendicular_upper_bound &&
-               current_particle.position.y < perpendicular_lower_bound) {
+    } else if (!is_horizontal && population_.velocity_x[current] < 0 &&
+               population_.position_y[current] > perpendicular_upper_bound &&
+               population_.position_y[current] < perpendicular_lower_bound) {
       // i.e. if the wall is the right side of the container
       return true;
     }
   } else {
-    if (is_horizontal && current_particle.velocity.y > 0 &&
-        current_particle.position.x > perpendicular_upper_bound &&
-        current_particle.position.x < perpendicular_lower_bound) {
+    if (is_horizontal && population_.velocity_y[current] > 0 &&
+        population_.position_x[current] > perpendicular_upper_bound &&
+        population_.position_x[current] < perpendicular_lower_bound) {
       // i.e. if the wall is the top side of the container
       return true;
-    } else if (!is_horizontal && current_particle.velocity.x > 0 &&
-               current_particle.position.y > perpendicular_upper_bound &&
-               current_particle.position.y < perpendicular_lower_bound) {
+    } else if (!is_horizontal && population_.velocity_x[current] > 0 &&
+               population_.position_y[current] > perpendicular_upper_bound &&
+               population_.position_y[current] < perpendicular_lower_bound) {
       // i.e. if the wall is the left side of the container
       return true;
     }
@@ -562,65 +837,70 @@ bool Disease::IsMovingTowardsWallOnOutside(const Disease::Person& current_partic
   return false;
 }
 
-bool Disease::ShouldBeQuarantined(const Disease::Person& current_person) const {
-  return (current_person.status == Status::kSymptomatic &&
-      current_person.time_infected >= kTimeToBeDetectedForQuarantine &&
-      !current_person.is_quarantined && should_quarantine_);
+bool Disease::ShouldBeQuarantined(size_t current) const {
+  return (population_.status[current] == Status::kSymptomatic &&
+      population_.time_infected[current] >= kTimeToBeDetectedForQuarantine &&
+      !population_.is_quarantined[current] && should_quarantine_);
 }
 
-Disease::Person Disease::QuarantinePerson(const Disease::Person& current_person) {
-  Person infected_person = current_person;
-
-  infected_person.position = vec2(ci::randFloat(quarantine_left_wall_, quarantine_right_wall_),
-                             ci::randFloat(quarantine_top_wall_, quarantine_bottom_wall_));
-  infected_person.is_quarantined = true;
-
-  return infected_person;
+void Disease::QuarantinePerson(size_t current_index) {
+  uint32_t id = population_.id[current_index];
+  population_.SetPosition(current_index,
+                          vec2(RandomFloat(id, RandomDraw::kQuarantinePositionX,
+                                           quarantine_left_wall_, quarantine_right_wall_),
+                               RandomFloat(id, RandomDraw::kQuarantinePositionY,
+                                           quarantine_top_wall_, quarantine_bottom_wall_)));
+  population_.is_quarantined[current_index] = true;
 }
 
 void Disease::UpdatePosition(size_t current_index) {
-  if (population_[current_index].is_quarantined) {
+  if (population_.is_quarantined[current_index]) {
     if (should_quarantine_) {
-      vec2 updated_position = population_[current_index].position +
-                              population_[current_index].velocity;
-      population_[current_index].position =
-          KeepWithinContainer(updated_position, population_[current_index].radius,
+      vec2 updated_position = population_.GetPosition(current_index) +
+                              population_.GetVelocity(current_index);
+      population_.SetPosition(current_index,
+          KeepWithinContainer(updated_position, population_.radius[current_index],
                               quarantine_left_wall_, quarantine_top_wall_,
-                              quarantine_right_wall_, quarantine_bottom_wall_);
+                              quarantine_right_wall_, quarantine_bottom_wall_));
     }
   } else {
     SocialDistance(current_index);
 
-    vec2 updated_position = population_[current_index].position +
-                            population_[current_index].velocity;
+    vec2 updated_position = population_.GetPosition(current_index) +
+                            population_.GetVelocity(current_index);
 
-    if (population_[current_index].is_at_central_location) {
-      population_[current_index].position =
-          KeepWithinContainer(updated_position, population_[current_index].radius,
+    if (population_.is_at_central_location[current_index]) {
+      population_.SetPosition(current_index,
+          KeepWithinContainer(updated_position, population_.radius[current_index],
                               location_left_wall_, location_top_wall_,
-                              location_right_wall_, location_bottom_wall_);
+                              location_right_wall_, location_bottom_wall_));
     } else {
-      population_[current_index].position =
-          KeepWithinContainer(updated_position, population_[current_index].radius,
-                              left_wall_, top_wall_, right_wall_, bottom_wall_);
+      population_.SetPosition(current_index,
+          KeepWithinContainer(updated_position, population_.radius[current_index],
+                              left_wall_, top_wall_, right_wall_, bottom_wall_));
     }
   }
 }
 
 void Disease::SocialDistance(size_t current_index) {
-  if (population_[current_index].is_social_distancing) {
-
-    // Find all the people who are within the bubble
-    for (size_t other_index = current_index + 1; other_index < population_.size(); other_index++) {
-      if (WithinDistancingBubble(population_[current_index], population_[other_index])) {
-        // Save the position of the person within the bubble
-        SavePositionRelativeToCurrentPerson(current_index, other_index);
-
-        // Check if the current particle needs to be added to the other person's save list
-        if (population_[other_index].is_social_distancing) {
-          SavePositionRelativeToCurrentPerson(other_index, current_index);
+  if (population_.is_social_distancing[current_index]) {
+    DISEASE_PROFILE_PHASE(tick_profiler_, TickPhase::kSocialDistance);
+
+    // Find all the people who are within the bubble (in two phases,
+    // they've already been found)
+    if (!should_update_in_two_phases_) {
+      ForEachWithinDistance(current_index, double(kAmountOfSocialDistance), [&](size_t other_index) {
+        if (other_index > current_index) {
+          // Save the position of the person within the bubble
+          SavePositionRelativeToCurrentPerson(current_index, other_index);
+
+          // Check if the current particle needs to be added to the other person's save list
+          if (population_.is_social_distancing[other_index]) {
+            SavePositionRelativeToCurrentPerson(other_index, current_index);
+          }
         }
-      }
+        return true;
+      });
     }
 
     // Determine the direction the person will have to move
@@ -629,30 +909,19 @@ void Disease::SocialDistance(size_t current_index) {
   }
 }
 
-bool Disease::WithinDistancingBubble(const Disease::Person& current_person, const Disease::Person& other_person) const {
-  // Calculate distance between center of particles
-  double position_x_val_difference = current_person.position.x - other_person.position.x;
-  double position_y_val_difference = current_person.position.y - other_person.position.y;
-  double sum_of_squared_differences = (position_x_val_difference * position_x_val_difference) +
-                                      (position_y_val_difference * position_y_val_difference);
-  double distance_between_centers = sqrt(sum_of_squared_differences);
-
-  return (distance_between_centers <= (current_person.radius + other_person.radius + kAmountOfSocialDistance));
-}
-
 void Disease::SavePositionRelativeToCurrentPerson(size_t current_index, size_t other_index) {
   // Check if the other person is to the right or left of the current person
-  if (population_[other_index].position.x > population_[current_index].position.x) {
-    population_[current_index].positions_of_people_in_bubble["right"] += 1;
-  } else if (population_[other_index].position.x < population_[current_index].position.x) {
-    population_[current_index].positions_of_people_in_bubble["left"] += 1;
+  if (population_.position_x[other_index] > population_.position_x[current_index]) {
+    population_.positions_of_people_in_bubble[current_index][Direction::kRight] += 1;
+  } else if (population_.position_x[other_index] < population_.position_x[current_index]) {
+    population_.positions_of_people_in_bubble[current_index][Direction::kLeft] += 1;
   }
 
   // Check if the other perosn is below or above the current person
-  if (population_[other_index].position.y > population_[current_index].position.y) {
-    population_[current_index].positions_of_people_in_bubble["down"] += 1;
-  } else if (population_[other_index].position.y < population_[current_index].position.y) {
-    population_[current_index].positions_of_people_in_bubble["up"] += 1;
+  if (population_.position_y[other_index] > population_.position_y[current_index]) {
+    population_.positions_of_people_in_bubble[current_index][Direction::kDown] += 1;
+  } else if (population_.position_y[other_index] < population_.position_y[current_index]) {
+    population_.positions_of_people_in_bubble[current_index][Direction::kUp] += 1;
   }
 }
 
@@ -660,10 +929,10 @@ void Disease::UpdateVelocity(size_t current_index) {
   int x_sign = 1;
   int y_sign = 1;
 
-  size_t num_people_above_current_particle = population_[current_index].positions_of_people_in_bubble["up"];
-  size_t num_people_below_current_particle = population_[current_index].positions_of_people_in_bubble["down"];
-  size_t num_people_left_current_particle = population_[current_index].positions_of_people_in_bubble["left"];
-  size_t num_people_right_current_particle = population_[current_index].positions_of_people_in_bubble["right"];
+  size_t num_people_above_current_particle = population_.positions_of_people_in_bubble[current_index][Direction::kUp];
+  size_t num_people_below_current_particle = population_.positions_of_people_in_bubble[current_index][Direction::kDown];
+  size_t num_people_left_current_particle = population_.positions_of_people_in_bubble[current_index][Direction::kLeft];
+  size_t num_people_right_current_particle = population_.positions_of_people_in_bubble[current_index][Direction::kRight];
 
   // Determine direction current particle needs to move in to maintain social distance
   if (num_people_above_current_particle < num_people_below_current_particle) {
@@ -676,21 +945,23 @@ void Disease::UpdateVelocity(size_t current_index) {
   // Change to the new velocity
   if (num_people_above_current_particle != num_people_below_current_particle) {
     if (is_new_distancing_velocity_random_) {
-      population_[current_index].velocity.y = ci::randFloat(0, 1);
+      population_.velocity_y[current_index] =
+          RandomFloat(population_.id[current_index], RandomDraw::kDistancingVelocityY, 0, 1);
     } else {
-      population_[current_index].velocity.y = abs(population_[current_index].velocity.y);
+      population_.velocity_y[current_index] = std::abs(population_.velocity_y[current_index]);
     }
   }
   if (num_people_left_current_particle != num_people_right_current_particle) {
     if (is_new_distancing_velocity_random_) {
-      population_[current_index].velocity.x = ci::randFloat(0, 1);
+      population_.velocity_x[current_index] =
+          RandomFloat(population_.id[current_index], RandomDraw::kDistancingVelocityX, 0, 1);
     } else {
-      population_[current_index].velocity.x = abs(population_[current_index].velocity.x);
+      population_.velocity_x[current_index] = std::abs(population_.velocity_x[current_index]);
     }
   }
 
-  population_[current_index].velocity.x = population_[current_index].velocity.x * x_sign;
-  population_[current_index].velocity.y = population_[current_index].velocity.y * y_sign;
+  population_.velocity_x[current_index] = population_.velocity_x[current_index] * x_sign;
+  population_.velocity_y[current_index] = population_.velocity_y[current_index] * y_sign;
 }
 
 vec2 Disease::KeepWithinContainer(const vec2& updated_position, double current_particle_radius,
@@ -712,4 +983,10 @@ vec2 Disease::KeepWithinContainer(const vec2& updated_position, double current_p
   return updated_position_within_container;
 }
 
-}  // namespace disease
\ No newline at end of file
+float Disease::RandomFloat(uint32_t id, RandomDraw draw,
+                           float lower_bound, float upper_bound) const {
+  return random_.GetFloat(id, uint32_t(num_of_ticks_), uint32_t(draw),
+                          lower_bound, upper_bound);
+}
+
+}  // namespace disease
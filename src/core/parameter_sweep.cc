@@ -0,0 +1,202 @@
+#include "core/parameter_sweep.h"
+
+#include "core/random.h"
+#include "core/thread_pool.h"
+#include <algorithm>
+
+namespace disease {
+
+namespace {
+
+// The features sampled by a Latin hypercube, each drawn from its own stream
+enum class SweptFeature {
+  kQuarantine,
+  kExposureTime,
+  kInfectedTime,
+  kSocialDistance,
+  kInfectionRadius,
+  kCentralLocation,
+};
+const size_t kNumOfSweptFeatures = 6;
+
+}  // namespace
+
+void FeatureSettings::ApplyTo(Disease& disease) const {
+  disease.SetShouldQuarantine(should_quarantine);
+  disease.SetExposureTime(exposure_time);
+  disease.SetInfectedTime(infected_time);
+  disease.SetPercentPerformingSocialDistance(percent_performing_social_distance);
+  disease.SetRadiusOfInfection(radius_of_infection);
+  disease.SetHaveCentralLocation(have_central_location);
+}
+
+ParameterSweep::ParameterSweep(const Disease& disease) : disease_(disease), num_of_threads_(1) {
+  // Runs are made side by side rather than splitting each tick between threads
+  disease_.SetNumOfThreads(1);
+}
+
+void ParameterSweep::SetNumOfThreads(size_t num_of_threads) {
+  num_of_threads_ = std::max(num_of_threads, size_t(1));
+}
+
+size_t ParameterSweep::GetNumOfThreads() const {
+  return num_of_threads_;
+}
+
+vector<size_t> ParameterSweep::GetFeatureValues(size_t minimum, size_t maximum) const {
+  vector<size_t> values;
+  for (size_t value = minimum; value <= maximum; value += disease_.GetFeatureIncrement()) {
+    values.push_back(value);
+  }
+  return values;
+}
+
+vector<FeatureSettings> ParameterSweep::GetGrid() const {
+  vector<size_t> exposure_times = GetFeatureValues(disease_.GetMinimumExposureTime(),
+                                                   disease_.GetMaximumExposureTime());
+  vector<size_t> infected_times = GetFeatureValues(disease_.GetMinimumInfectedTime(),
+                                                   disease_.GetMaximumInfectedTime());
+  vector<size_t> social_distances = GetFeatureValues(disease_.GetMinimumSocialDistancePercentage(),
+                                                     disease_.GetMaximumSocialDistancePercentage());
+  vector<size_t> infection_radii = GetFeatureValues(disease_.GetMinimumInfectionRadius(),
+                                                    disease_.GetMaximumInfectionRadius());
+
+  vector<FeatureSettings> grid;
+  FeatureSettings settings;
+  for (bool should_quarantine : {false, true}) {
+    settings.should_quarantine = should_quarantine;
+    for (size_t exposure_time : exposure_times) {
+      settings.exposure_time = exposure_time;
+      for (size_t infected_time : infected_times) {
+        settings.infected_time = infected_time;
+        for (size_t social_distance : social_distances) {
+          settings.percent_performing_social_distance = social_distance;
+          for (size_t infection_radius : infection_radii) {
+            settings.radius_of_infection = infection_radius;
+            for (bool have_central_location : {false, true}) {
+              settings.have_central_location = have_central_location;
+              if (IsAllowed(settings)) {
+                grid.push_back(settings);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return grid;
+}
+
+vector<FeatureSettings> ParameterSweep::GetLatinHypercube(size_t num_of_samples, uint64_t seed) const {
+  const vector<size_t> kBooleanValues = {0, 1};
+  vector<size_t> feature_values[kNumOfSweptFeatures] = {
+      kBooleanValues,
+      GetFeatureValues(disease_.GetMinimumExposureTime(), disease_.GetMaximumExposureTime()),
+      GetFeatureValues(disease_.GetMinimumInfectedTime(), disease_.GetMaximumInfectedTime()),
+      GetFeatureValues(disease_.GetMinimumSocialDistancePercentage(),
+                       disease_.GetMaximumSocialDistancePercentage()),
+      GetFeatureValues(disease_.GetMinimumInfectionRadius(), disease_.GetMaximumInfectionRadius()),
+      kBooleanValues};
+
+  Random random(seed);
+  vector<size_t> strata(num_of_samples);
+  vector<size_t> sampled_values[kNumOfSweptFeatures];
+
+  for (size_t feature = 0; feature < kNumOfSweptFeatures; feature++) {
+    // Shuffle the strata (Fisher-Yates), so each feature uses them in its own order
+    for (size_t stratum = 0; stratum < num_of_samples; stratum++) {
+      strata[stratum] = stratum;
+    }
+    for (size_t last = num_of_samples; last > 1; last--) {
+      size_t other = size_t(random.GetFloat(feature, uint32_t(last), 0, 0, 1) * last);
+      std::swap(strata[last - 1], strata[std::min(other, last - 1)]);
+    }
+
+    // Pick a random point within each sample's stratum
+    const vector<size_t>& values = feature_values[feature];
+    for (size_t sample = 0; sample < num_of_samples; sample++) {
+      double position = (strata[sample] + random.GetFloat(feature, uint32_t(sample), 1, 0, 1)) /
+                        num_of_samples;
+      size_t value_index = std::min(size_t(position * values.size()), values.size() - 1);
+      sampled_values[feature].push_back(values[value_index]);
+    }
+  }
+
+  vector<FeatureSettings> samples(num_of_samples);
+  for (size_t sample = 0; sample < num_of_samples; sample++) {
+    FeatureSettings& settings = samples[sample];
+    settings.should_quarantine = sampled_values[size_t(SweptFeature::kQuarantine)][sample] != 0;
+    settings.exposure_time = sampled_values[size_t(SweptFeature::kExposureTime)][sample];
+    settings.infected_time = sampled_values[size_t(SweptFeature::kInfectedTime)][sample];
+    settings.percent_performing_social_distance =
+        sampled_values[size_t(SweptFeature::kSocialDistance)][sample];
+    settings.radius_of_infection = std::max(
+        sampled_values[size_t(SweptFeature::kInfectionRadius)][sample],
+        disease_.GetMinimumAllowedRadius(settings.percent_performing_social_distance));
+    settings.have_central_location = sampled_values[size_t(SweptFeature::kCentralLocation)][sample] != 0;
+  }
+  return samples;
+}
+
+vector<SweepResult> ParameterSweep::Run(const vector<FeatureSettings>& settings,
+                                        size_t num_of_ticks) const {
+  vector<SweepResult> results(settings.size());
+  auto run_once = [&](size_t run) { results[run] = RunOnce(settings[run], num_of_ticks); };
+
+  ThreadPool pool(num_of_threads_);
+  pool.ParallelForBalanced(settings.size(), run_once);
+  return results;
+}
+
+SweepResult ParameterSweep::RunOnce(const FeatureSettings& settings, size_t num_of_ticks) const {
+  Disease disease = disease_;
+  settings.ApplyTo(disease);
+  disease.SetPopulation(vector<Disease::Person>());
+  disease.CreatePopulation();
+
+  SweepResult result;
+  result.peak_infectious = disease.GetStatusCounts().GetNumOfInfectious();
+
+  while (result.num_of_ticks_run < num_of_ticks && disease.GetStatusCounts().GetNumOfInfectious() != 0) {
+    disease.UpdateParticles();
+    result.num_of_ticks_run++;
+
+    size_t num_of_infectious = disease.GetStatusCounts().GetNumOfInfectious();
+    if (num_of_infectious > result.peak_infectious) {
+      result.peak_infectious = num_of_infectious;
+      result.time_to_peak = result.num_of_ticks_run;
+    }
+  }
+
+  result.final_counts = disease.GetStatusCounts();
+  return result;
+}
+
+void ParameterSweep::Write(const vector<FeatureSettings>& settings, const vector<SweepResult>& results,
+                           std::ostream& output) const {
+  output << "quarantine,exposure_time,infected_time,social_distance,infection_radius,"
+         << "central_location,susceptible,symptomatic,asymptomatic,removed,"
+         << "peak_infectious,time_to_peak,ticks_run\n";
+
+  for (size_t run = 0; run < std::min(settings.size(), results.size()); run++) {
+    const FeatureSettings& run_settings = settings[run];
+    const SweepResult& result = results[run];
+
+    output << run_settings.should_quarantine << ',' << run_settings.exposure_time << ','
+           << run_settings.infected_time << ',' << run_settings.percent_performing_social_distance << ','
+           << run_settings.radius_of_infection << ',' << run_settings.have_central_location << ','
+           << result.final_counts[Status::kSusceptible] << ','
+           << result.final_counts[Status::kSymptomatic] << ','
+           << result.final_counts[Status::kAsymptomatic] << ','
+           << result.final_counts[Status::kRemoved] << ','
+           << result.peak_infectious << ',' << result.time_to_peak << ','
+           << result.num_of_ticks_run << '\n';
+  }
+}
+
+bool ParameterSweep::IsAllowed(const FeatureSettings& settings) const {
+  return settings.radius_of_infection >=
+         disease_.GetMinimumAllowedRadius(settings.percent_performing_social_distance);
+}
+
+}  // namespace disease
@@ -0,0 +1,235 @@
+#include "core/population.h"
+
+namespace disease {
+
+vec3 GetStatusColor(Status status) {
+  switch (status) {
+    case Status::kSusceptible:
+      return vec3(0, 0, 1);
+    case Status::kSymptomatic:
+      return vec3(1, 0, 0);
+    case Status::kAsymptomatic:
+      return vec3(1, 1, 0);
+    case Status::kRemoved:
+      return vec3(0.5, 0.5, 0.5);
+  }
+  return vec3(0, 0, 0);
+}
+
+size_t& StatusCounts::operator[](Status status) {
+  return counts[size_t(status)];
+}
+
+size_t StatusCounts::operator[](Status status) const {
+  return counts[size_t(status)];
+}
+
+size_t StatusCounts::GetNumOfInfectious() const {
+  return (*this)[Status::kSymptomatic] + (*this)[Status::kAsymptomatic];
+}
+
+size_t StatusCounts::GetTotal() const {
+  size_t total = 0;
+  for (size_t count : counts) {
+    total += count;
+  }
+  return total;
+}
+
+void StatusCounts::Clear() {
+  for (size_t& count : counts) {
+    count = 0;
+  }
+}
+
+size_t& BubbleCounts::operator[](Direction direction) {
+  return counts[size_t(direction)];
+}
+
+size_t BubbleCounts::operator[](Direction direction) const {
+  return counts[size_t(direction)];
+}
+
+bool BubbleCounts::IsEmpty() const {
+  for (size_t count : counts) {
+    if (count != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void BubbleCounts::Clear() {
+  for (size_t& count : counts) {
+    count = 0;
+  }
+}
+
+size_t Population::Size() const {
+  return status.size();
+}
+
+bool Population::IsEmpty() const {
+  return status.empty();
+}
+
+void Population::Clear() {
+  position_x.clear();
+  position_y.clear();
+  velocity_x.clear();
+  velocity_y.clear();
+  status.clear();
+  continuous_exposure_time.clear();
+  time_infected.clear();
+  radius.clear();
+  color.clear();
+  has_been_exposed_in_frame.clear();
+  is_quarantined.clear();
+  is_social_distancing.clear();
+  positions_of_people_in_bubble.clear();
+  is_going_to_central_location.clear();
+  is_at_central_location.clear();
+  id.clear();
+  index_of_id.clear();
+}
+
+void Population::Reserve(size_t num_of_people) {
+  position_x.reserve(num_of_people);
+  position_y.reserve(num_of_people);
+  velocity_x.reserve(num_of_people);
+  velocity_y.reserve(num_of_people);
+  status.reserve(num_of_people);
+  continuous_exposure_time.reserve(num_of_people);
+  time_infected.reserve(num_of_people);
+  radius.reserve(num_of_people);
+  color.reserve(num_of_people);
+  has_been_exposed_in_frame.reserve(num_of_people);
+  is_quarantined.reserve(num_of_people);
+  is_social_distancing.reserve(num_of_people);
+  positions_of_people_in_bubble.reserve(num_of_people);
+  is_going_to_central_location.reserve(num_of_people);
+  is_at_central_location.reserve(num_of_people);
+  id.reserve(num_of_people);
+  index_of_id.reserve(num_of_people);
+}
+
+void Population::Add(const Person& person) {
+  position_x.push_back(person.position.x);
+  position_y.push_back(person.position.y);
+  velocity_x.push_back(person.velocity.x);
+  velocity_y.push_back(person.velocity.y);
+  status.push_back(person.status);
+  continuous_exposure_time.push_back(person.continuous_exposure_time);
+  time_infected.push_back(person.time_infected);
+  radius.push_back(person.radius);
+  color.push_back(person.color);
+  has_been_exposed_in_frame.push_back(person.has_been_exposed_in_frame);
+  is_quarantined.push_back(person.is_quarantined);
+  is_social_distancing.push_back(person.is_social_distancing);
+  positions_of_people_in_bubble.push_back(person.positions_of_people_in_bubble);
+  is_going_to_central_location.push_back(person.is_going_to_central_location);
+  is_at_central_location.push_back(person.is_at_central_location);
+  index_of_id.push_back(uint32_t(id.size()));
+  id.push_back(uint32_t(id.size()));
+}
+
+void Population::Reorder(vector<size_t>& order) {
+  // Follow each cycle of the permutation, holding on to the first person in
+  // the cycle until the last one has moved into their old index
+  for (size_t start = 0; start < order.size(); start++) {
+    if (order[start] == start) {
+      continue;
+    }
+
+    Person first_person = GetPerson(start);
+    uint32_t first_id = id[start];
+
+    size_t current = start;
+    while (order[current] != start) {
+      size_t next = order[current];
+      SetPerson(current, GetPerson(next));
+      id[current] = id[next];
+
+      order[current] = current;
+      current = next;
+    }
+
+    SetPerson(current, first_person);
+    id[current] = first_id;
+    order[current] = current;
+  }
+
+  for (size_t index = 0; index < Size(); index++) {
+    index_of_id[id[index]] = uint32_t(index);
+  }
+}
+
+Person Population::GetPerson(size_t index) const {
+  Person person;
+
+  person.radius = radius[index];
+  person.position = GetPosition(index);
+  person.velocity = GetVelocity(index);
+  person.status = status[index];
+  person.color = color[index];
+  person.continuous_exposure_time = continuous_exposure_time[index];
+  person.time_infected = time_infected[index];
+  person.has_been_exposed_in_frame = has_been_exposed_in_frame[index];
+  person.is_quarantined = is_quarantined[index];
+  person.is_social_distancing = is_social_distancing[index];
+  person.positions_of_people_in_bubble = positions_of_people_in_bubble[index];
+  person.is_going_to_central_location = is_going_to_central_location[index];
+  person.is_at_central_location = is_at_central_location[index];
+
+  return person;
+}
+
+void Population::SetPerson(size_t index, const Person& person) {
+  SetPosition(index, person.position);
+  SetVelocity(index, person.velocity);
+  status[index] = person.status;
+  continuous_exposure_time[index] = person.continuous_exposure_time;
+  time_infected[index] = person.time_infected;
+  radius[index] = person.radius;
+  color[index] = person.color;
+  has_been_exposed_in_frame[index] = person.has_been_exposed_in_frame;
+  is_quarantined[index] = person.is_quarantined;
+  is_social_distancing[index] = person.is_social_distancing;
+  positions_of_people_in_bubble[index] = person.positions_of_people_in_bubble;
+  is_going_to_central_location[index] = person.is_going_to_central_location;
+  is_at_central_location[index] = person.is_at_central_location;
+}
+
+vector<Person> Population::ToVector() const {
+  vector<Person> people(Size());
+
+  for (size_t index = 0; index < Size(); index++) {
+    people[id[index]] = GetPerson(index);
+  }
+
+  return people;
+}
+
+size_t Population::GetIndex(uint32_t person_id) const {
+  return index_of_id[person_id];
+}
+
+vec2 Population::GetPosition(size_t index) const {
+  return vec2(position_x[index], position_y[index]);
+}
+
+vec2 Population::GetVelocity(size_t index) const {
+  return vec2(velocity_x[index], velocity_y[index]);
+}
+
+void Population::SetPosition(size_t index, const vec2& position) {
+  position_x[index] = position.x;
+  position_y[index] = position.y;
+}
+
+void Population::SetVelocity(size_t index, const vec2& velocity) {
+  velocity_x[index] = velocity.x;
+  velocity_y[index] = velocity.y;
+}
+
+}  // namespace disease
@@ -0,0 +1,34 @@
+#include "core/population_snapshot.h"
+
+namespace disease {
+
+size_t PopulationSnapshot::Size() const {
+  return position.size();
+}
+
+bool PopulationSnapshot::IsEmpty() const {
+  return position.empty();
+}
+
+void PopulationSnapshot::Clear() {
+  position.clear();
+  radius.clear();
+  color.clear();
+  status.clear();
+}
+
+void PopulationSnapshot::CopyFrom(const Population& population) {
+  size_t num_of_people = population.Size();
+
+  position.resize(num_of_people);
+  radius.resize(num_of_people);
+  for (size_t index = 0; index < num_of_people; index++) {
+    position[index] = vec2(population.position_x[index], population.position_y[index]);
+    radius[index] = float(population.radius[index]);
+  }
+
+  color.assign(population.color.begin(), population.color.end());
+  status.assign(population.status.begin(), population.status.end());
+}
+
+}  // namespace disease
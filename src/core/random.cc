@@ -0,0 +1,60 @@
+#include "core/random.h"
+
+namespace disease {
+
+namespace {
+
+// Philox4x32 multipliers and Weyl sequence constants for the key schedule
+const uint32_t kMultiplier0 = 0xD2511F53;
+const uint32_t kMultiplier1 = 0xCD9E8D57;
+const uint32_t kKeyIncrement0 = 0x9E3779B9;
+const uint32_t kKeyIncrement1 = 0xBB67AE85;
+
+}  // namespace
+
+Random::Random() : seed_(kDefaultSeed) {}
+
+Random::Random(uint64_t seed) : seed_(seed) {}
+
+void Random::SetSeed(uint64_t seed) {
+  seed_ = seed;
+}
+
+uint64_t Random::GetSeed() const {
+  return seed_;
+}
+
+float Random::GetFloat(uint64_t stream, uint32_t step, uint32_t draw,
+                       float lower_bound, float upper_bound) const {
+  uint32_t counter[4] = {draw, step, uint32_t(stream), uint32_t(stream >> 32)};
+  Scramble(counter);
+
+  // Top 24 bits give every float in [0, 1) with a multiple of 2^-24 equal chance
+  float unit_value = float(counter[0] >> 8) * (1.0f / 16777216.0f);
+  return lower_bound + (upper_bound - lower_bound) * unit_value;
+}
+
+void Random::Scramble(uint32_t counter[4]) const {
+  uint32_t key0 = uint32_t(seed_);
+  uint32_t key1 = uint32_t(seed_ >> 32);
+
+  for (size_t round = 0; round < kNumOfRounds; round++) {
+    uint64_t product0 = uint64_t(kMultiplier0) * counter[0];
+    uint64_t product1 = uint64_t(kMultiplier1) * counter[2];
+
+    uint32_t scrambled[4] = {
+        uint32_t(product1 >> 32) ^ counter[1] ^ key0,
+        uint32_t(product1),
+        uint32_t(product0 >> 32) ^ counter[3] ^ key1,
+        uint32_t(product0),
+    };
+    for (size_t word = 0; word < 4; word++) {
+      counter[word] = scrambled[word];
+    }
+
+    key0 += kKeyIncrement0;
+    key1 += kKeyIncrement1;
+  }
+}
+
+}  // namespace disease
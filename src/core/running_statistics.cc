@@ -0,0 +1,99 @@
+#include "core/running_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace disease {
+
+const size_t RunningStatistics::kNumOfBins;
+
+RunningStatistics::RunningStatistics() : RunningStatistics(0) {}
+
+RunningStatistics::RunningStatistics(size_t maximum_value)
+    : maximum_value_(maximum_value),
+      bin_width_(maximum_value / kNumOfBins + 1),
+      num_of_samples_(0), smallest_sample_(maximum_value), largest_sample_(0),
+      sum_(0), sum_of_squares_(0) {
+  std::fill(bins_, bins_ + kNumOfBins, 0);
+}
+
+void RunningStatistics::Add(size_t value) {
+  num_of_samples_++;
+  smallest_sample_ = std::min(smallest_sample_, value);
+  largest_sample_ = std::max(largest_sample_, value);
+  sum_ += value;
+  sum_of_squares_ += uint64_t(value) * value;
+  bins_[std::min(value / bin_width_, kNumOfBins - 1)]++;
+}
+
+void RunningStatistics::Merge(const RunningStatistics& other) {
+  num_of_samples_ += other.num_of_samples_;
+  smallest_sample_ = std::min(smallest_sample_, other.smallest_sample_);
+  largest_sample_ = std::max(largest_sample_, other.largest_sample_);
+  sum_ += other.sum_;
+  sum_of_squares_ += other.sum_of_squares_;
+  for (size_t bin = 0; bin < kNumOfBins; bin++) {
+    bins_[bin] += other.bins_[bin];
+  }
+}
+
+size_t RunningStatistics::GetNumOfSamples() const {
+  return size_t(num_of_samples_);
+}
+
+size_t RunningStatistics::GetMaximumValue() const {
+  return maximum_value_;
+}
+
+double RunningStatistics::GetMean() const {
+  if (num_of_samples_ == 0) {
+    return 0;
+  }
+  return double(sum_) / double(num_of_samples_);
+}
+
+double RunningStatistics::GetVariance() const {
+  if (num_of_samples_ < 2) {
+    return 0;
+  }
+
+  // Long double, since the totals can be too large to subtract as doubles
+  long double num_of_samples = num_of_samples_;
+  long double sum = sum_;
+  long double variance = (sum_of_squares_ - sum * sum / num_of_samples) / (num_of_samples - 1);
+  return double(std::max(variance, 0.0L));
+}
+
+double RunningStatistics::GetStandardDeviation() const {
+  return std::sqrt(GetVariance());
+}
+
+double RunningStatistics::GetQuantile(double fraction) const {
+  if (num_of_samples_ == 0) {
+    return 0;
+  }
+
+  // The rank (starting at 1) of the sample the quantile falls on
+  uint64_t rank = uint64_t(std::ceil(std::max(0.0, std::min(fraction, 1.0)) * num_of_samples_));
+  rank = std::max(rank, uint64_t(1));
+
+  uint64_t num_of_smaller_samples = 0;
+  for (size_t bin = 0; bin < kNumOfBins; bin++) {
+    if (num_of_smaller_samples + bins_[bin] < rank) {
+      num_of_smaller_samples += bins_[bin];
+      continue;
+    }
+
+    // Spread the bin's samples evenly over the values it counts
+    double lowest_value = double(bin * bin_width_);
+    double position = 0;
+    if (bins_[bin] > 1) {
+      position = double(rank - num_of_smaller_samples - 1) / double(bins_[bin] - 1);
+    }
+    double value = lowest_value + position * (bin_width_ - 1);
+    return std::max(double(smallest_sample_), std::min(value, double(largest_sample_)));
+  }
+  return double(largest_sample_);
+}
+
+}  // namespace disease
@@ -0,0 +1,121 @@
+#include "core/spatial_grid.h"
+
+#include <algorithm>
+
+namespace disease {
+
+void SpatialGrid::Rebuild(const vector<float>& positions_x,
+                          const vector<float>& positions_y, double cell_size) {
+  Rebuild(positions_x, positions_y, vector<double>(), cell_size);
+}
+
+void SpatialGrid::Rebuild(const vector<float>& positions_x, const vector<float>& positions_y,
+                          const vector<double>& radii, double cell_size) {
+  size_t num_of_positions = positions_x.size();
+  cell_items_.clear();
+  cell_positions_x_.clear();
+  cell_positions_y_.clear();
+  cell_radii_.clear();
+  cell_radii_single_.clear();
+  if (num_of_positions == 0) {
+    num_of_columns_ = 0;
+    num_of_rows_ = 0;
+    cell_starts_.assign(1, 0);
+    return;
+  }
+
+  // Fit the grid to the particles (some may be in the quarantine box, which
+  // is outside of the container)
+  double right = positions_x.front();
+  double bottom = positions_y.front();
+  left_ = right;
+  top_ = bottom;
+  for (size_t index = 0; index < num_of_positions; index++) {
+    left_ = std::min(left_, double(positions_x[index]));
+    right = std::max(right, double(positions_x[index]));
+    top_ = std::min(top_, double(positions_y[index]));
+    bottom = std::max(bottom, double(positions_y[index]));
+  }
+
+  // Grow the cells if the particles are spread out so thinly that the
+  // grid would mostly be empty cells
+  cell_size_ = std::max(cell_size, 1.0);
+  size_t max_num_of_cells = kMaxCellsPerParticle * num_of_positions;
+  while (true) {
+    num_of_columns_ = size_t((right - left_) / cell_size_) + 1;
+    num_of_rows_ = size_t((bottom - top_) / cell_size_) + 1;
+    if (num_of_columns_ * num_of_rows_ <= max_num_of_cells) {
+      break;
+    }
+    cell_size_ *= 2;
+  }
+
+  // Reserve for the most cells there can be, so the number of cells changing
+  // as people move around doesn't reallocate
+  Reserve(num_of_positions);
+
+  // Count the particles in each cell, then turn the counts into the
+  // starting offsets of each cell
+  cell_starts_.assign(num_of_columns_ * num_of_rows_ + 1, 0);
+  cell_of_item_.resize(num_of_positions);
+  for (size_t index = 0; index < num_of_positions; index++) {
+    size_t cell = size_t(CellCoordinate(positions_y[index], top_)) * num_of_columns_ +
+                  size_t(CellCoordinate(positions_x[index], left_));
+    cell_of_item_[index] = cell;
+    cell_starts_[cell + 1]++;
+  }
+  for (size_t cell = 1; cell < cell_starts_.size(); cell++) {
+    cell_starts_[cell] += cell_starts_[cell - 1];
+  }
+
+  // Place the indices (in increasing order within each cell)
+  cell_cursors_.assign(cell_starts_.begin(), cell_starts_.end() - 1);
+  cell_items_.resize(num_of_positions);
+  for (size_t index = 0; index < num_of_positions; index++) {
+    cell_items_[cell_cursors_[cell_of_item_[index]]++] = index;
+  }
+
+  // Copy the positions and radii into the same order, so the particles in
+  // neighboring cells can be compared without jumping around the population
+  cell_positions_x_.resize(num_of_positions);
+  cell_positions_y_.resize(num_of_positions);
+  cell_radii_.resize(num_of_positions);
+  cell_radii_single_.resize(num_of_positions);
+  for (size_t item = 0; item < num_of_positions; item++) {
+    size_t index = cell_items_[item];
+    cell_positions_x_[item] = positions_x[index];
+    cell_positions_y_[item] = positions_y[index];
+    cell_radii_[item] = radii.empty() ? 0 : radii[index];
+    cell_radii_single_[item] = float(cell_radii_[item]);
+  }
+}
+
+size_t SpatialGrid::GetNumOfColumns() const {
+  return num_of_columns_;
+}
+
+size_t SpatialGrid::GetNumOfRows() const {
+  return num_of_rows_;
+}
+
+double SpatialGrid::GetCellSize() const {
+  return cell_size_;
+}
+
+void SpatialGrid::Reserve(size_t num_of_particles) {
+  size_t max_num_of_cells = kMaxCellsPerParticle * num_of_particles;
+  cell_starts_.reserve(max_num_of_cells + 1);
+  cell_cursors_.reserve(max_num_of_cells);
+  cell_items_.reserve(num_of_particles);
+  cell_of_item_.reserve(num_of_particles);
+  cell_positions_x_.reserve(num_of_particles);
+  cell_positions_y_.reserve(num_of_particles);
+  cell_radii_.reserve(num_of_particles);
+  cell_radii_single_.reserve(num_of_particles);
+}
+
+long SpatialGrid::CellCoordinate(double coordinate, double origin) const {
+  return long(std::floor((coordinate - origin) / cell_size_));
+}
+
+}  // namespace disease
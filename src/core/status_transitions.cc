@@ -0,0 +1,64 @@
+#include "core/status_transitions.h"
+
+#include <algorithm>
+
+namespace disease {
+
+StatusTransitions::StatusTransitions() : size_(0) {}
+
+StatusTransitions::StatusTransitions(const StatusTransitions& other)
+    : transitions_(other.transitions_), size_(other.size_.load()) {}
+
+StatusTransitions& StatusTransitions::operator=(const StatusTransitions& other) {
+  transitions_ = other.transitions_;
+  size_ = other.size_.load();
+  return *this;
+}
+
+void StatusTransitions::Reset(size_t num_of_people) {
+  if (transitions_.size() < num_of_people) {
+    transitions_.resize(num_of_people);
+  }
+  size_ = 0;
+}
+
+void StatusTransitions::Record(size_t index, uint32_t id, Status from, Status to) {
+  size_t position = size_.fetch_add(1, std::memory_order_relaxed);
+  transitions_[position] = {index, id, from, to};
+}
+
+void StatusTransitions::SortByIndex() {
+  std::sort(transitions_.begin(), transitions_.begin() + Size(),
+            [](const StatusTransition& first, const StatusTransition& second) {
+              return first.index < second.index;
+            });
+}
+
+void StatusTransitions::ApplyTo(StatusCounts& status_counts) const {
+  for (const StatusTransition& transition : *this) {
+    status_counts[transition.from]--;
+    status_counts[transition.to]++;
+  }
+}
+
+size_t StatusTransitions::Size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+bool StatusTransitions::IsEmpty() const {
+  return Size() == 0;
+}
+
+const StatusTransition& StatusTransitions::operator[](size_t position) const {
+  return transitions_[position];
+}
+
+const StatusTransition* StatusTransitions::begin() const {
+  return transitions_.data();
+}
+
+const StatusTransition* StatusTransitions::end() const {
+  return transitions_.data() + Size();
+}
+
+}  // namespace disease
@@ -0,0 +1,85 @@
+#include "core/thread_pool.h"
+
+namespace disease {
+
+ThreadPool::ThreadPool(size_t num_of_threads)
+    : generation_(0), num_of_busy_workers_(0), is_stopping_(false),
+      job_(nullptr), job_context_(nullptr), num_of_items_(0) {
+  for (size_t thread_index = 1; thread_index < num_of_threads; thread_index++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, thread_index);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopping_ = true;
+  }
+  work_ready_.notify_all();
+
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::GetNumOfThreads() const {
+  return workers_.size() + 1;
+}
+
+void ThreadPool::Run(size_t num_of_items, RangeJob job, void* context) {
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = job;
+    job_context_ = context;
+    num_of_items_ = num_of_items;
+    num_of_busy_workers_ = workers_.size();
+    generation_++;
+  }
+  work_ready_.notify_all();
+
+  RunChunk(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  work_done_.wait(lock, [this] { return num_of_busy_workers_ == 0; });
+}
+
+void ThreadPool::RunChunk(size_t thread_index) const {
+  size_t num_of_threads = GetNumOfThreads();
+  size_t begin = num_of_items_ * thread_index / num_of_threads;
+  size_t end = num_of_items_ * (thread_index + 1) / num_of_threads;
+
+  if (begin < end) {
+    job_(job_context_, begin, end);
+  }
+}
+
+void ThreadPool::WorkerLoop(size_t thread_index) {
+  size_t last_generation = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_ready_.wait(lock, [&] { return is_stopping_ || generation_ != last_generation; });
+      if (is_stopping_) {
+        return;
+      }
+      last_generation = generation_;
+    }
+
+    RunChunk(thread_index);
+
+    bool is_last_to_finish;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      num_of_busy_workers_--;
+      is_last_to_finish = (num_of_busy_workers_ == 0);
+    }
+    if (is_last_to_finish) {
+      work_done_.notify_one();
+    }
+  }
+}
+
+}  // namespace disease
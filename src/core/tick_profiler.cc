@@ -0,0 +1,150 @@
+#include "core/tick_profiler.h"
+
+#include "core/allocation_counter.h"
+#include <algorithm>
+
+namespace disease {
+
+const size_t TickProfile::kNumOfPhases;
+const bool TickProfiler::kIsEnabled;
+const size_t TickProfiler::kNumOfTicksAveraged;
+
+double TickProfile::GetMicroseconds(TickPhase phase) const {
+  return microseconds[size_t(phase)];
+}
+
+const char* TickProfile::GetPhaseName(TickPhase phase) {
+  switch (phase) {
+    case TickPhase::kTick:
+      return "tick";
+    case TickPhase::kReorder:
+      return "reorder";
+    case TickPhase::kResetFrame:
+      return "reset frame";
+    case TickPhase::kFindInteractions:
+      return "find interactions";
+    case TickPhase::kStatusUpdate:
+      return "status update";
+    case TickPhase::kCentralLocation:
+      return "central location";
+    case TickPhase::kWallCollisions:
+      return "wall collisions";
+    case TickPhase::kSocialDistance:
+      return "social distance";
+    case TickPhase::kMovement:
+      return "movement";
+  }
+  return "";
+}
+
+void TickProfiler::TickTotals::Add(const TickTotals& other) {
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    nanoseconds[phase] += other.nanoseconds[phase];
+  }
+  pair_tests += other.pair_tests;
+  allocations += other.allocations;
+}
+
+TickProfile TickProfiler::TickTotals::GetAverage(size_t num_of_ticks) const {
+  TickProfile profile;
+  profile.num_of_ticks = num_of_ticks;
+  if (num_of_ticks == 0) {
+    return profile;
+  }
+
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    profile.microseconds[phase] = double(nanoseconds[phase]) / 1000 / num_of_ticks;
+  }
+  profile.pair_tests = double(pair_tests) / num_of_ticks;
+  profile.allocations = double(allocations) / num_of_ticks;
+  return profile;
+}
+
+TickProfiler::TickProfiler() {
+  Clear();
+}
+
+TickProfiler::TickProfiler(const TickProfiler& other) {
+  *this = other;
+}
+
+TickProfiler& TickProfiler::operator=(const TickProfiler& other) {
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    current_nanoseconds_[phase] = other.current_nanoseconds_[phase].load();
+  }
+  current_pair_tests_ = other.current_pair_tests_.load();
+  allocations_at_tick_start_ = other.allocations_at_tick_start_;
+
+  std::copy(other.recent_ticks_, other.recent_ticks_ + kNumOfTicksAveraged, recent_ticks_);
+  num_of_recent_ticks_ = other.num_of_recent_ticks_;
+  next_recent_tick_ = other.next_recent_tick_;
+
+  overall_totals_ = other.overall_totals_;
+  num_of_ticks_ = other.num_of_ticks_;
+  return *this;
+}
+
+void TickProfiler::AddTime(TickPhase phase, uint64_t nanoseconds) {
+  current_nanoseconds_[size_t(phase)].fetch_add(nanoseconds, std::memory_order_relaxed);
+}
+
+void TickProfiler::AddPairTests(uint64_t num_of_pair_tests) {
+  current_pair_tests_.fetch_add(num_of_pair_tests, std::memory_order_relaxed);
+}
+
+void TickProfiler::StartTick() {
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    current_nanoseconds_[phase] = 0;
+  }
+  current_pair_tests_ = 0;
+  allocations_at_tick_start_ = GetNumOfAllocations();
+}
+
+void TickProfiler::EndTick() {
+  TickTotals tick;
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    tick.nanoseconds[phase] = current_nanoseconds_[phase];
+  }
+  tick.pair_tests = current_pair_tests_;
+  tick.allocations = GetNumOfAllocations() - allocations_at_tick_start_;
+
+  recent_ticks_[next_recent_tick_] = tick;
+  next_recent_tick_ = (next_recent_tick_ + 1) % kNumOfTicksAveraged;
+  num_of_recent_ticks_ = std::min(num_of_recent_ticks_ + 1, kNumOfTicksAveraged);
+
+  overall_totals_.Add(tick);
+  num_of_ticks_++;
+}
+
+void TickProfiler::Clear() {
+  StartTick();
+
+  std::fill(recent_ticks_, recent_ticks_ + kNumOfTicksAveraged, TickTotals());
+  num_of_recent_ticks_ = 0;
+  next_recent_tick_ = 0;
+
+  overall_totals_ = TickTotals();
+  num_of_ticks_ = 0;
+}
+
+TickProfile TickProfiler::GetRecentAverage() const {
+  TickTotals recent_totals;
+  for (size_t tick = 0; tick < num_of_recent_ticks_; tick++) {
+    recent_totals.Add(recent_ticks_[tick]);
+  }
+  return recent_totals.GetAverage(num_of_recent_ticks_);
+}
+
+TickProfile TickProfiler::GetOverallAverage() const {
+  return overall_totals_.GetAverage(num_of_ticks_);
+}
+
+ScopedPhaseTimer::ScopedPhaseTimer(TickProfiler& profiler, TickPhase phase)
+    : profiler_(profiler), phase_(phase), start_(std::chrono::steady_clock::now()) {}
+
+ScopedPhaseTimer::~ScopedPhaseTimer() {
+  auto elapsed = std::chrono::steady_clock::now() - start_;
+  profiler_.AddTime(phase_, uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+}  // namespace disease
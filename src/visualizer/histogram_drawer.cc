@@ -0,0 +1,295 @@
+#include "visualizer/histogram_drawer.h"
+
+#include "cinder/Log.h"
+#include <cstddef>
+
+namespace disease {
+
+namespace visualizer {
+
+HistogramDrawer::HistogramDrawer(const vec2& container_top_right_corner) {
+  container_top_right_corner_ = container_top_right_corner;
+
+  bottom_most_boundary_of_histogram_ = container_top_right_corner.y + kHistogramGraphDimension +
+                                       kLabelSpacingFromHistogramTimes2 + kLabelSpacingFromHistogram;
+  x_coordinate_of_status_stat_labels_ = container_top_right_corner_.x +
+      kSpacingFromContainer + kHistogramGraphDimension +
+      kLabelSpacingFromHistogramTimes2 + kLabelSpacingFromHistogramTimes2;
+}
+
+size_t HistogramDrawer::GetBottomMostBoundaryOfHistogram() const {
+  return bottom_most_boundary_of_histogram_;
+}
+
+size_t HistogramDrawer::GetXCoordinateOfStatusStatLabels() const {
+  return x_coordinate_of_status_stat_labels_;
+}
+
+size_t HistogramDrawer::GetYCoordinateOfLastStatusStatLabel() const {
+  return container_top_right_corner_.y + kLabelSpacingFromHistogram +
+      (kNumOfStatuses - 1) * kLabelSpacingFromHistogramTimes2;
+}
+
+void HistogramDrawer::DrawHistogram(const Histogram& histogram) const {
+  // Draws the background of histogram
+  double left_boundary_of_histogram = container_top_right_corner_.x + kSpacingFromContainer;
+  DrawHistogramBackground(left_boundary_of_histogram, container_top_right_corner_.y);
+
+  // Draws the bins of histogram
+  DrawHistogramBins(histogram, left_boundary_of_histogram, container_top_right_corner_.y);
+
+  // Draws the labels of histogram
+  DrawHistogramLabels(histogram, left_boundary_of_histogram, container_top_right_corner_.y);
+}
+
+vector<vec2> HistogramDrawer::DrawHistogramBackground(double left_boundary_of_histogram,
+                                                      double histogram_top_left_corner_y) const {
+  vec2 pixel_top_left = vec2(left_boundary_of_histogram, histogram_top_left_corner_y);
+  vec2 pixel_bottom_right =
+      pixel_top_left + vec2(kHistogramGraphDimension, kHistogramGraphDimension);
+  ci::Rectf pixel_bounding_box(pixel_top_left, pixel_bottom_right);
+
+  ci::gl::color(ci::Color("blue"));
+  ci::gl::drawSolidRect(pixel_bounding_box);
+
+  vector<vec2> corner_positions;
+  corner_positions.push_back(pixel_top_left);
+  corner_positions.push_back(pixel_bottom_right);
+
+  return corner_positions;
+}
+
+void HistogramDrawer::DrawHistogramBins(const Histogram& histogram,
+                                        double left_boundary_of_histogram,
+                                        double histogram_top_left_corner_y) const {
+  const vector<HistogramBin>& bins = histogram.GetBins();
+  double time_elapsed_since_outbreak = histogram.GetTimeElapsedSinceOutbreak();
+  double upper_bound_for_y = histogram.GetUpperBoundForY();
+
+  if (bins.empty() || time_elapsed_since_outbreak == 0 || upper_bound_for_y == 0) {
+    return;
+  }
+
+  // Bins are laid out in frames and people, so only this scale changes as time goes on
+  ci::gl::ScopedModelMatrix scoped_model_matrix;
+  ci::gl::translate(vec2(left_boundary_of_histogram, histogram_top_left_corner_y + kHistogramGraphDimension));
+  ci::gl::scale(vec2(kHistogramGraphDimension / time_elapsed_since_outbreak,
+                     -kHistogramGraphDimension / upper_bound_for_y));
+
+  // The last bin may still gain frames, so it's drawn on its own
+  size_t frames_per_bin = histogram.GetFramesPerBin();
+  size_t num_of_full_bins = bins.size();
+  if (bins.back().num_of_frames < frames_per_bin) {
+    num_of_full_bins--;
+  }
+
+  size_t first_bin_to_draw = 0;
+  if (UpdateBinMesh(histogram, num_of_full_bins)) {
+    bin_batch_->draw(0, GLsizei(num_of_bins_in_mesh_ * kVerticesPerBin));
+    first_bin_to_draw = num_of_bins_in_mesh_;
+  }
+
+  for (size_t index = first_bin_to_draw; index < bins.size(); index++) {
+    double left_x = double(index * frames_per_bin);
+    DrawBin(bins[index], left_x, left_x + bins[index].num_of_frames, upper_bound_for_y);
+  }
+}
+
+bool HistogramDrawer::UpdateBinMesh(const Histogram& histogram, size_t num_of_full_bins) const {
+  if (has_bin_mesh_failed_) {
+    return false;
+  }
+
+  if (!bin_batch_) {
+    try {
+      // Room for as many bins as the histogram keeps, so it's only created once
+      size_t num_of_vertices = Histogram::kMaximumNumOfBins * kVerticesPerBin;
+      bin_vertex_buffer_ = ci::gl::Vbo::create(GL_ARRAY_BUFFER, num_of_vertices * sizeof(BinVertex),
+                                               nullptr, GL_DYNAMIC_DRAW);
+
+      ci::geom::BufferLayout vertex_layout;
+      vertex_layout.append(ci::geom::Attrib::POSITION, 2, sizeof(BinVertex), offsetof(BinVertex, position));
+      vertex_layout.append(ci::geom::Attrib::COLOR, 3, sizeof(BinVertex), offsetof(BinVertex, color));
+
+      ci::gl::VboMeshRef bin_mesh = ci::gl::VboMesh::create(uint32_t(num_of_vertices), GL_TRIANGLES,
+                                                            {{vertex_layout, bin_vertex_buffer_}});
+      bin_batch_ = ci::gl::Batch::create(bin_mesh, ci::gl::getStockShader(ci::gl::ShaderDef().color()));
+    } catch (const ci::Exception& exception) {
+      CI_LOG_EXCEPTION("histogram vertex buffer unavailable, drawing bins one by one", exception);
+      has_bin_mesh_failed_ = true;
+      bin_vertex_buffer_.reset();
+      bin_batch_.reset();
+      return false;
+    }
+  }
+
+  if (histogram.GetBinLayoutVersion() != bin_layout_version_in_mesh_) {
+    bin_layout_version_in_mesh_ = histogram.GetBinLayoutVersion();
+    num_of_bins_in_mesh_ = 0;
+  }
+
+  if (num_of_full_bins > num_of_bins_in_mesh_) {
+    const vector<HistogramBin>& bins = histogram.GetBins();
+    size_t frames_per_bin = histogram.GetFramesPerBin();
+
+    new_bin_vertices_.clear();
+    for (size_t index = num_of_bins_in_mesh_; index < num_of_full_bins; index++) {
+      double left_x = double(index * frames_per_bin);
+      AddBinVertices(bins[index], left_x, left_x + frames_per_bin, histogram.GetUpperBoundForY(),
+                     new_bin_vertices_);
+    }
+
+    bin_vertex_buffer_->bufferSubData(num_of_bins_in_mesh_ * kVerticesPerBin * sizeof(BinVertex),
+                                      new_bin_vertices_.size() * sizeof(BinVertex),
+                                      new_bin_vertices_.data());
+    num_of_bins_in_mesh_ = num_of_full_bins;
+  }
+
+  return true;
+}
+
+void HistogramDrawer::AddBinVertices(const HistogramBin& bin, double left_x, double right_x,
+                                     double upper_bound_for_y, vector<BinVertex>& vertices) const {
+  double symptomatic_height = bin.GetAverage(Status::kSymptomatic);
+  double asymptomatic_height = bin.GetAverage(Status::kAsymptomatic);
+  double removed_height = bin.GetAverage(Status::kRemoved);
+
+  // Bottom and top of each status' rect; empty statuses get empty rects, so
+  // every bin has the same number of vertices
+  double bottoms[] = {0, symptomatic_height, upper_bound_for_y - removed_height};
+  double tops[] = {symptomatic_height, symptomatic_height + asymptomatic_height, upper_bound_for_y};
+  Status statuses[] = {Status::kSymptomatic, Status::kAsymptomatic, Status::kRemoved};
+
+  for (size_t rect = 0; rect < 3; rect++) {
+    vec3 color = GetStatusColor(statuses[rect]);
+    vec2 bottom_left(left_x, bottoms[rect]);
+    vec2 bottom_right(right_x, bottoms[rect]);
+    vec2 top_left(left_x, tops[rect]);
+    vec2 top_right(right_x, tops[rect]);
+
+    BinVertex rect_vertices[] = {{bottom_left, color}, {bottom_right, color}, {top_right, color},
+                                 {bottom_left, color}, {top_right, color}, {top_left, color}};
+    vertices.insert(vertices.end(), rect_vertices, rect_vertices + 6);
+  }
+}
+
+void HistogramDrawer::DrawBin(const HistogramBin& bin, double left_x, double right_x,
+                              double upper_bound_for_y) const {
+  double symptomatic_height = bin.GetAverage(Status::kSymptomatic);
+  double asymptomatic_height = bin.GetAverage(Status::kAsymptomatic);
+  double removed_height = bin.GetAverage(Status::kRemoved);
+
+  if (symptomatic_height != 0) {
+    DrawStatusBin(left_x, symptomatic_height, right_x, 0, GetStatusColor(Status::kSymptomatic));
+  }
+
+  if (asymptomatic_height != 0) {
+    DrawStatusBin(left_x, symptomatic_height + asymptomatic_height, right_x, symptomatic_height,
+                  GetStatusColor(Status::kAsymptomatic));
+  }
+
+  if (removed_height != 0) {
+    DrawStatusBin(left_x, upper_bound_for_y, right_x, upper_bound_for_y - removed_height,
+                  GetStatusColor(Status::kRemoved));
+  }
+}
+
+void HistogramDrawer::DrawStatusBin(double bin_top_left_x, double bin_top_left_y,
+                                    double bin_bottom_right_x, double bin_bottom_right_y,
+                                    const vec3& color) const {
+  vec2 removed_bin_top_left =
+      vec2(bin_top_left_x, bin_top_left_y);
+  vec2 removed_bin_bottom_right =
+      vec2(bin_bottom_right_x, bin_bottom_right_y);
+
+  ci::Rectf bin_box(removed_bin_top_left, removed_bin_bottom_right);
+  ci::gl::color(ci::Color(color.x, color.y, color.z));
+  ci::gl::drawSolidRect(bin_box);
+}
+
+void HistogramDrawer::DrawHistogramLabels(const Histogram& histogram,
+                                          double left_boundary_of_histogram,
+                                          double histogram_top_left_corner_y) const {
+  // Label title
+  double x_centered_color_label = (left_boundary_of_histogram + (left_boundary_of_histogram + kHistogramGraphDimension)) /2;
+  double y_centered_color_label = histogram_top_left_corner_y - kLabelSpacingFromHistogram;
+  ci::gl::drawStringCentered(
+      "Population Status Over Time",
+      glm::vec2(x_centered_color_label, y_centered_color_label), ci::Color("black"));
+
+  // Label axes
+  DrawAxesLabels(left_boundary_of_histogram, histogram_top_left_corner_y);
+
+  // Label bounds of axes
+  DrawBoundsLabels(histogram, left_boundary_of_histogram, histogram_top_left_corner_y);
+
+  DrawStatusStatistics(histogram);
+}
+
+void HistogramDrawer::DrawAxesLabels(double left_boundary_of_histogram,
+                                     double histogram_top_left_corner_y) const {
+  double x_centered_x_axis_label = (left_boundary_of_histogram + (left_boundary_of_histogram + kHistogramGraphDimension)) /2;
+  double y_centered_x_axis_label = histogram_top_left_corner_y + kHistogramGraphDimension +
+      kLabelSpacingFromHistogramTimes2 + kLabelSpacingFromHistogram;
+  ci::gl::drawStringCentered(
+      "Time Since Outbreak",
+      glm::vec2(x_centered_x_axis_label, y_centered_x_axis_label), ci::Color("black"));
+
+  double x_centered_y_axis_label = (container_top_right_corner_.x + left_boundary_of_histogram) / 2;
+  double y_centered_y_axis_label = (histogram_top_left_corner_y + (histogram_top_left_corner_y + kHistogramGraphDimension)) / 2;
+  ci::gl::drawStringCentered(
+      "Num of people",
+      glm::vec2(x_centered_y_axis_label, y_centered_y_axis_label), ci::Color("black"));
+}
+
+void HistogramDrawer::DrawBoundsLabels(const Histogram& histogram,
+                                       double left_boundary_of_histogram,
+                                       double histogram_top_left_corner_y) const {
+  double time_elapsed_since_outbreak = histogram.GetTimeElapsedSinceOutbreak();
+
+  ci::gl::drawString(std::to_string(int(time_elapsed_since_outbreak)),
+                     vec2(left_boundary_of_histogram + kHistogramGraphDimension + kLabelSpacingFromHistogram,
+                          histogram_top_left_corner_y + kHistogramGraphDimension), ci::Color("black"));
+
+  ci::gl::drawString(std::to_string(int(time_elapsed_since_outbreak / 2)),
+                     vec2(left_boundary_of_histogram + kHistogramGraphDimension / 2,
+                          histogram_top_left_corner_y + kHistogramGraphDimension + kLabelSpacingFromHistogram),
+                     ci::Color("black"));
+
+  ci::gl::drawStringCentered("0",
+                             vec2(left_boundary_of_histogram - kLabelSpacingFromHistogram,
+                                  histogram_top_left_corner_y + kHistogramGraphDimension), ci::Color("black"));
+
+  ci::gl::drawStringCentered(std::to_string(int(histogram.GetUpperBoundForY())),
+                             vec2(left_boundary_of_histogram - kLabelSpacingFromHistogram,
+                                  histogram_top_left_corner_y), ci::Color("black"));
+}
+
+void HistogramDrawer::DrawStatusStatistics(const Histogram& histogram) const {
+  const StatusCounts& status_counts = histogram.GetStatusCounts();
+
+  size_t num_susceptible = status_counts[Status::kSusceptible];
+  size_t num_symptomatic = status_counts[Status::kSymptomatic];
+  size_t num_asymptomatic = status_counts[Status::kAsymptomatic];
+  size_t num_removed = status_counts[Status::kRemoved];
+
+  size_t label_spacing_y = container_top_right_corner_.y + kLabelSpacingFromHistogram;
+  ci::gl::drawString("Number of People Susceptible: " + std::to_string(num_susceptible),
+                    vec2(x_coordinate_of_status_stat_labels_, label_spacing_y), ci::Color("blue"));
+
+  label_spacing_y += kLabelSpacingFromHistogramTimes2;
+  ci::gl::drawString("Number of People Symptomatic: " + std::to_string(num_symptomatic),
+                     vec2(x_coordinate_of_status_stat_labels_, label_spacing_y), ci::Color("red"));
+
+  label_spacing_y += kLabelSpacingFromHistogramTimes2;
+  ci::gl::drawString("Number of People Asymptomatic: " + std::to_string(num_asymptomatic),
+                     vec2(x_coordinate_of_status_stat_labels_, label_spacing_y), ci::Color("black"));
+
+  label_spacing_y += kLabelSpacingFromHistogramTimes2;
+  ci::gl::drawString("Number of People Removed: " + std::to_string(num_removed),
+                     vec2(x_coordinate_of_status_stat_labels_, label_spacing_y),ci::Color("gray"));
+}
+
+}  // namespace visualizer
+
+}  // namespace disease
@@ -6,10 +6,13 @@ namespace visualizer {
 
 InfectiousDiseaseApp::InfectiousDiseaseApp() {
   ci::app::setWindowSize(int(kWindowSizeX), int(kWindowSizeY));
+  last_update_time_ = ci::app::getElapsedSeconds();
 }
 
 void InfectiousDiseaseApp::update() {
-  simulator_.Update();
+  double current_time = ci::app::getElapsedSeconds();
+  simulator_.Advance(current_time - last_update_time_);
+  last_update_time_ = current_time;
 }
 
 void InfectiousDiseaseApp::draw() {
@@ -18,9 +21,10 @@ void InfectiousDiseaseApp::draw() {
 
   simulator_.Draw();
 
-  if (simulator_.GetParticlesInfo().size() != 0) {
+  if (!simulator_.GetParticlesInfo().IsEmpty()) {
     cinder::gl::drawStringCentered(
-        "Press 'Delete' to end the simulation.",
+        "Press 'Delete' to end the simulation. Press the left/right arrow keys to change the speed, "
+        "or 'm' for max speed.",
         glm::vec2((kWindowSizeX + simulator_.GetRightMargin()) / 2, simulator_.GetTopMargin() / 2),
         ci::Color("black"));
   } else {
@@ -69,6 +73,26 @@ void InfectiousDiseaseApp::keyDown(ci::app::KeyEvent event) {
       simulator_.ChangeFeatureValue(false);
       break;
 
+    case ci::app::KeyEvent::KEY_RIGHT:
+      simulator_.SetTicksPerFrame(simulator_.GetTicksPerFrame() * 2);
+      break;
+
+    case ci::app::KeyEvent::KEY_LEFT:
+      simulator_.SetTicksPerFrame(simulator_.GetTicksPerFrame() / 2);
+      break;
+
+    case ci::app::KeyEvent::KEY_m:
+      simulator_.SetIsRunningAtMaxSpeed(!simulator_.GetIsRunningAtMaxSpeed());
+      break;
+
+    case ci::app::KeyEvent::KEY_g:
+      simulator_.SetIsDrawingInstanced(!simulator_.GetIsDrawingInstanced());
+      break;
+
+    case ci::app::KeyEvent::KEY_p:
+      simulator_.SetIsShowingTickProfile(!simulator_.GetIsShowingTickProfile());
+      break;
+
     case ci::app::KeyEvent::KEY_DELETE:
       // End breakout and clear container and histogram
       simulator_.Clear();
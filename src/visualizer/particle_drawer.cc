@@ -0,0 +1,154 @@
+#include <visualizer/particle_drawer.h>
+
+#include "cinder/Log.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace disease {
+
+namespace visualizer {
+
+namespace {
+
+// Scales and moves the unit circle mesh to each particle
+const char* const kVertexShader = R"(
+#version 150
+
+uniform mat4 ciModelViewProjection;
+
+in vec4 ciPosition;
+in vec3 iPositionAndRadius;
+in vec3 iColor;
+
+out vec3 vColor;
+
+void main() {
+  vColor = iColor;
+  vec2 position = ciPosition.xy * iPositionAndRadius.z + iPositionAndRadius.xy;
+  gl_Position = ciModelViewProjection * vec4(position, 0.0, 1.0);
+}
+)";
+
+const char* const kFragmentShader = R"(
+#version 150
+
+in vec3 vColor;
+
+out vec4 oColor;
+
+void main() {
+  oColor = vec4(vColor, 1.0);
+}
+)";
+
+}  // namespace
+
+ParticleDrawer::ParticleDrawer() {
+  is_instanced_ = true;
+  has_instancing_failed_ = false;
+  instance_capacity_ = 0;
+}
+
+void ParticleDrawer::DrawParticles(const PopulationSnapshot& particles) const {
+  if (particles.IsEmpty()) {
+    return;
+  }
+
+  if (is_instanced_ && PrepareInstancing(particles.Size())) {
+    DrawInstanced(particles);
+  } else {
+    DrawOneByOne(particles);
+  }
+}
+
+bool ParticleDrawer::PrepareInstancing(size_t num_of_particles) const {
+  if (has_instancing_failed_) {
+    return false;
+  }
+
+  if (num_of_particles <= instance_capacity_) {
+    return true;
+  }
+
+  try {
+    if (!shader_) {
+      shader_ = ci::gl::GlslProg::create(
+          ci::gl::GlslProg::Format().vertex(kVertexShader).fragment(kFragmentShader));
+    }
+
+    // Grows by doubling, so a growing population rarely recreates the buffer
+    size_t capacity = std::max(instance_capacity_, kMinimumInstanceCapacity);
+    while (capacity < num_of_particles) {
+      capacity *= 2;
+    }
+
+    instance_buffer_ = ci::gl::Vbo::create(GL_ARRAY_BUFFER, capacity * sizeof(ParticleInstance),
+                                           nullptr, GL_DYNAMIC_DRAW);
+
+    ci::geom::BufferLayout instance_layout;
+    instance_layout.append(ci::geom::Attrib::CUSTOM_0, 3, sizeof(ParticleInstance),
+                           offsetof(ParticleInstance, position), 1);
+    instance_layout.append(ci::geom::Attrib::CUSTOM_1, 3, sizeof(ParticleInstance),
+                           offsetof(ParticleInstance, color), 1);
+
+    ci::gl::VboMeshRef circle_mesh = ci::gl::VboMesh::create(
+        ci::geom::Circle().radius(1).subdivisions(int(kCircleSubdivisions)));
+    circle_mesh->appendVbo(instance_layout, instance_buffer_);
+
+    batch_ = ci::gl::Batch::create(circle_mesh, shader_,
+                                   {{ci::geom::Attrib::CUSTOM_0, "iPositionAndRadius"},
+                                    {ci::geom::Attrib::CUSTOM_1, "iColor"}});
+    instance_capacity_ = capacity;
+  } catch (const ci::Exception& exception) {
+    CI_LOG_EXCEPTION("instanced particles unavailable, drawing them one by one", exception);
+    has_instancing_failed_ = true;
+    instance_capacity_ = 0;
+    batch_.reset();
+    instance_buffer_.reset();
+    return false;
+  }
+
+  return true;
+}
+
+void ParticleDrawer::DrawInstanced(const PopulationSnapshot& particles) const {
+  size_t num_of_particles = particles.Size();
+
+  ParticleInstance* instances = static_cast<ParticleInstance*>(instance_buffer_->mapReplace());
+  if (instances == nullptr) {
+    DrawOneByOne(particles);
+    return;
+  }
+
+  for (size_t index = 0; index < num_of_particles; index++) {
+    instances[index].position = particles.position[index];
+    instances[index].radius = particles.radius[index];
+    instances[index].color = particles.color[index];
+  }
+  instance_buffer_->unmap();
+
+  batch_->drawInstanced(GLsizei(num_of_particles));
+}
+
+void ParticleDrawer::DrawOneByOne(const PopulationSnapshot& particles) const {
+  for (size_t index = 0; index < particles.Size(); index++) {
+    // Figured out how to color a particle from:
+    // https://libcinder.org/docs/guides/opengl/part1.html
+    const vec3& color = particles.color[index];
+    ci::gl::color(ci::Color(color.x, color.y, color.z));
+
+    ci::gl::drawSolidCircle(particles.position[index], particles.radius[index]);
+  }
+}
+
+void ParticleDrawer::SetIsInstanced(bool is_instanced) {
+  is_instanced_ = is_instanced;
+}
+
+bool ParticleDrawer::GetIsInstanced() const {
+  return is_instanced_ && !has_instancing_failed_;
+}
+
+}  // namespace visualizer
+
+}  // namespace disease
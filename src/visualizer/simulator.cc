@@ -1,17 +1,20 @@
 #include <visualizer/simulator.h>
 
+#include <algorithm>
+#include <chrono>
+
 namespace disease {
 
 namespace visualizer {
 
 using glm::vec2;
 
-Simulator::Simulator() : histogram_(disease_.GetPopulation(),
-                                   vec2(kLeftContainerMargin, kTopContainerMargin) +
-                                   vec2(kContainerWidth, 0)) {
+Simulator::Simulator() : histogram_drawer_(vec2(kLeftContainerMargin, kTopContainerMargin) +
+                                           vec2(kContainerWidth, 0)),
+                         published_status_counts_(kMaximumUntakenTicks) {
   // Initialize container values
   quarantine_box_top_left_x_ = kLeftContainerMargin + kContainerWidth + kSpacesFromContainer;
-  quarantine_box_top_left_y_ = histogram_.GetBottomMostBoundaryOfHistogram() + kSpacesFromContainer;
+  quarantine_box_top_left_y_ = histogram_drawer_.GetBottomMostBoundaryOfHistogram() + kSpacesFromContainer;
   quarantine_box_bottom_right_x_ = quarantine_box_top_left_x_ + kQuarantineBoxWidth;
   quarantine_box_bottom_right_y_ = kTopContainerMargin + kContainerHeight;
 
@@ -26,26 +29,188 @@ Simulator::Simulator() : histogram_(disease_.GetPopulation(),
                           location_top_margin_ + kLocationDimension));
   time_passed_ = 0;
   feature_currently_being_changed_ = FeatureChangeKey::kQuarantine;
+
+  ticks_per_frame_ = 1;
+  tick_accumulator_ = 0;
+  is_running_at_max_speed_ = false;
+  should_stop_worker_ = false;
+  is_showing_tick_profile_ = false;
+}
+
+Simulator::~Simulator() {
+  StopWorker();
 }
 
 void Simulator::Update() {
+  RunTick();
+  PublishParticles();
+  TakeLatestParticles();
+}
+
+void Simulator::Advance(double elapsed_seconds) {
+  if (is_running_at_max_speed_) {
+    TakeLatestSnapshot();
+    return;
+  }
+
+  tick_accumulator_ += elapsed_seconds * kTicksPerSecond * ticks_per_frame_;
+  tick_accumulator_ = std::min(tick_accumulator_, kMaximumFramesToCatchUp * ticks_per_frame_);
+
+  size_t num_of_ticks = size_t(tick_accumulator_);
+  if (num_of_ticks == 0) {
+    return;
+  }
+  tick_accumulator_ -= num_of_ticks;
+
+  for (size_t tick = 0; tick < num_of_ticks; tick++) {
+    RunTick();
+  }
+  PublishParticles();
+  TakeLatestParticles();
+}
+
+void Simulator::RunTick() {
   disease_.UpdateParticles();
-  particles_info = disease_.GetPopulation();
 
-  if (particles_info.size() != 0) {
+  if (disease_.GetStatusCounts().GetTotal() != 0) {
     time_passed_++;
   }
-  histogram_.Update(particles_info, time_passed_);
+  histogram_.Update(disease_.GetStatusCounts(), time_passed_);
+
+  KeepInfectionRadiusAboveSocialDistance();
+}
+
+void Simulator::KeepInfectionRadiusAboveSocialDistance() {
+  size_t minimum_radius =
+      disease_.GetMinimumAllowedRadius(disease_.GetPercentPerformingSocialDistance());
+  if (disease_.GetRadiusOfInfection() < minimum_radius) {
+    disease_.SetRadiusOfInfection(minimum_radius);
+  }
+}
+
+void Simulator::SetTicksPerFrame(size_t ticks_per_frame) {
+  ticks_per_frame_ = std::max(size_t(1), std::min(ticks_per_frame, kMaximumTicksPerFrame));
+}
+
+void Simulator::SetIsRunningAtMaxSpeed(bool is_running_at_max_speed) {
+  if (is_running_at_max_speed == is_running_at_max_speed_) {
+    return;
+  }
 
-  if (disease_.GetPercentPerformingSocialDistance() != 0 &&
-      disease_.GetRadiusOfInfection() < disease_.GetAmountOfSocialDistance() + kIncrementOrDecrementBy) {
-    disease_.SetRadiusOfInfection(disease_.GetAmountOfSocialDistance() + kIncrementOrDecrementBy);
+  if (is_running_at_max_speed) {
+    is_running_at_max_speed_ = true;
+    StartWorker();
+  } else {
+    StopWorker();
+    is_running_at_max_speed_ = false;
+    tick_accumulator_ = 0;
+  }
+}
+
+void Simulator::SetIsDrawingInstanced(bool is_drawing_instanced) {
+  particle_drawer_.SetIsInstanced(is_drawing_instanced);
+}
+
+void Simulator::SetIsShowingTickProfile(bool is_showing_tick_profile) {
+  is_showing_tick_profile_ = is_showing_tick_profile && TickProfiler::kIsEnabled;
+}
+
+void Simulator::StartWorker() {
+  if (!is_running_at_max_speed_ || worker_.joinable() ||
+      disease_.GetStatusCounts().GetTotal() == 0) {
+    return;
+  }
+
+  // Nothing else changes the disease while the background thread is running
+  KeepInfectionRadiusAboveSocialDistance();
+
+  should_stop_worker_ = false;
+  worker_ = std::thread(&Simulator::RunAtMaxSpeed, this);
+}
+
+void Simulator::StopWorker() {
+  if (!worker_.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(worker_mutex_);
+    should_stop_worker_ = true;
+  }
+  worker_can_continue_.notify_one();
+  worker_.join();
+  TakeLatestSnapshot();
+}
+
+void Simulator::RunAtMaxSpeed() {
+  std::chrono::steady_clock::time_point last_publish_time;  // so the first tick is published
+
+  while (!should_stop_worker_) {
+    // Producer side, so room can only grow until the push below
+    if (published_status_counts_.IsFull()) {
+      std::unique_lock<std::mutex> lock(worker_mutex_);
+      worker_can_continue_.wait(lock, [this] {
+        return should_stop_worker_ || !published_status_counts_.IsFull();
+      });
+      continue;
+    }
+
+    disease_.UpdateParticles();
+    published_status_counts_.TryPush(disease_.GetStatusCounts());
+
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<double>(now - last_publish_time).count() >= kSecondsBetweenPublishes) {
+      PublishParticles();
+      last_publish_time = now;
+    }
+  }
+
+  PublishParticles();
+}
+
+void Simulator::PublishParticles() {
+  snapshots_.GetWriteBuffer().CopyFrom(disease_.GetPopulationData());
+  snapshots_.Publish();
+
+  if (TickProfiler::kIsEnabled) {
+    tick_profiles_.GetWriteBuffer() = disease_.GetTickProfiler().GetRecentAverage();
+    tick_profiles_.Publish();
+  }
+}
+
+void Simulator::TakeLatestParticles() {
+  snapshots_.TakeLatest();
+  tick_profiles_.TakeLatest();
+}
+
+void Simulator::TakeLatestSnapshot() {
+  TakeLatestParticles();
+
+  StatusCounts status_counts;
+  bool has_taken_status_counts = false;
+  while (published_status_counts_.TryPop(status_counts)) {
+    if (status_counts.GetTotal() != 0) {
+      time_passed_++;
+    }
+    histogram_.Update(status_counts, time_passed_);
+    has_taken_status_counts = true;
+  }
+
+  if (has_taken_status_counts) {
+    // Taking the lock means the worker is either waiting already or will see
+    // the room before it waits, so the wakeup can't be missed
+    { std::lock_guard<std::mutex> lock(worker_mutex_); }
+    worker_can_continue_.notify_one();
   }
 }
 
 void Simulator::Draw() const {
+  std::string speed = std::to_string(ticks_per_frame_) + " ticks per frame";
+  if (is_running_at_max_speed_) {
+    speed = "max speed";
+  }
   ci::gl::drawStringCentered(
-      "Time elapsed: " + std::to_string(time_passed_),
+      "Time elapsed: " + std::to_string(time_passed_) + " (" + speed + ")",
       glm::vec2((2*kLeftContainerMargin + kContainerWidth) / 2, kTopContainerMargin / 2), ci::Color("black"));
 
   // Draw the container
@@ -53,13 +218,14 @@ void Simulator::Draw() const {
   DrawCentralLocation();
 
   // Draw the histograms
-  if (particles_info.size() != 0) {
-    histogram_.DrawHistogram();
+  if (!GetParticlesInfo().IsEmpty()) {
+    histogram_drawer_.DrawHistogram(histogram_);
     DrawQuarantineBox();
   }
 
   // Draw the particles
   DrawParticles();
+  DrawTickProfile();
 
   DrawFeatureChangeInstructions();
   DrawFeatureLabels();
@@ -88,22 +254,39 @@ void Simulator::DrawCentralLocation() const {
 }
 
 void Simulator::DrawParticles() const {
-  if (!particles_info.empty()) {
-    for (Disease::Person particle : particles_info) {
-      // Draws the particles
-      // Figured out how to color a particle from:
-      // https://libcinder.org/docs/guides/opengl/part1.html
-      ci::gl::color(ci::Color(particle.color.x, particle.color.y, particle.color.z));
-
-      vec2 center = particle.position;
-      ci::gl::drawSolidCircle(center, particle.radius);
-    }
+  particle_drawer_.DrawParticles(GetParticlesInfo());
+}
+
+void Simulator::DrawTickProfile() const {
+  if (!is_showing_tick_profile_) {
+    return;
   }
+
+  const TickProfile& profile = GetTickProfile();
+  vec2 location = vec2(kLeftContainerMargin, kTopContainerMargin) + vec2(kTickProfileMargin);
+
+  ci::gl::drawString(
+      "Average of the last " + std::to_string(profile.num_of_ticks) + " ticks (microseconds)",
+      location, ci::Color("white"));
+
+  for (size_t phase = 0; phase < TickProfile::kNumOfPhases; phase++) {
+    location.y += kSpacesFromContainer;
+    ci::gl::drawString(
+        std::string(TickProfile::GetPhaseName(TickPhase(phase))) + ": " +
+        std::to_string(profile.microseconds[phase]),
+        location, ci::Color("white"));
+  }
+
+  location.y += kSpacesFromContainer;
+  ci::gl::drawString(
+      "Pair tests: " + std::to_string(size_t(profile.pair_tests)) +
+      ", allocations: " + std::to_string(size_t(profile.allocations)),
+      location, ci::Color("white"));
 }
 
 void Simulator::DrawQuarantineBox() const {
   if (disease_.GetShouldQuarantineValue()) {
-    if (!particles_info.empty()) {
+    if (!GetParticlesInfo().IsEmpty()) {
       vec2 pixel_top_left = vec2(quarantine_box_top_left_x_, quarantine_box_top_left_y_);
       vec2 pixel_bottom_right = vec2(quarantine_box_bottom_right_x_, quarantine_box_bottom_right_y_);
       ci::Rectf pixel_bounding_box(pixel_top_left, pixel_bottom_right);
@@ -115,9 +298,9 @@ void Simulator::DrawQuarantineBox() const {
 }
 
 void Simulator::DrawFeatureChangeInstructions() const {
-  if (particles_info.empty()) {
+  if (GetParticlesInfo().IsEmpty()) {
     double x_location = kLeftContainerMargin + kContainerWidth + kSpacesFromContainer;
-    double y_location = histogram_.GetYCoordinateOfLastStatusStatLabel() + kInitialYLocForFeatureStats;
+    double y_location = histogram_drawer_.GetYCoordinateOfLastStatusStatLabel() + kInitialYLocForFeatureStats;
 
     // General instructions
     double general_instructions_y_location = y_location - kInitialYLocForGeneralInstructionsMultiplier *
@@ -166,8 +349,8 @@ void Simulator::DrawFeatureChangeInstructions() const {
 }
 
 void Simulator::DrawFeatureLabels() const {
-  double x_location = histogram_.GetXCoordinateOfStatusStatLabels();
-  double y_location = histogram_.GetYCoordinateOfLastStatusStatLabel() + kInitialYLocForFeatureStats;
+  double x_location = histogram_drawer_.GetXCoordinateOfStatusStatLabels();
+  double y_location = histogram_drawer_.GetYCoordinateOfLastStatusStatLabel() + kInitialYLocForFeatureStats;
 
   ci::gl::drawString(
       "FEATURE STATS",
@@ -214,7 +397,7 @@ std::string Simulator::ConvertFromBool(bool boolean_value) const {
 }
 
 void Simulator::DrawConstraintsMessage(double y_location) const {
-  double x_location = histogram_.GetXCoordinateOfStatusStatLabels();
+  double x_location = histogram_drawer_.GetXCoordinateOfStatusStatLabels();
 
   switch (int(feature_currently_being_changed_)) {
     case 1:
@@ -255,7 +438,7 @@ void Simulator::DrawConstraintsMessage(double y_location) const {
         ci::gl::drawString(GetFeatureBeingChanged() + " is at its min value",
                            glm::vec2(x_location, y_location), ci::Color("red"));
       } else if (disease_.GetRadiusOfInfection() <= (disease_.GetAmountOfSocialDistance() +
-          kIncrementOrDecrementBy) &&
+          disease_.GetFeatureIncrement()) &&
           disease_.GetPercentPerformingSocialDistance() != 0) {
         ci::gl::drawString(GetFeatureBeingChanged() + " is at its min value",
                            glm::vec2(x_location, y_location), ci::Color("red"));
@@ -269,6 +452,7 @@ void Simulator::DrawConstraintsMessage(double y_location) const {
 
 void Simulator::CreatePopulation() {
   disease_.CreatePopulation();
+  StartWorker();
 }
 
 void Simulator::ChangeFeature(FeatureChangeKey feature_to_change) {
@@ -276,7 +460,7 @@ void Simulator::ChangeFeature(FeatureChangeKey feature_to_change) {
 }
 
 void Simulator::ChangeFeatureValue(bool is_key_up) {
-  if (particles_info.empty()) {
+  if (GetParticlesInfo().IsEmpty() && !worker_.joinable()) {
     switch (int(feature_currently_being_changed_)) {
       case 0:  // kQuarantine
         if (disease_.GetShouldQuarantineValue()) {
@@ -289,11 +473,11 @@ void Simulator::ChangeFeatureValue(bool is_key_up) {
       case 1:  // kExposureTime
         if (is_key_up) {
           if (disease_.GetExposureTime() < disease_.GetMaximumExposureTime()) {
-            disease_.SetExposureTime(disease_.GetExposureTime() + kIncrementOrDecrementBy);
+            disease_.SetExposureTime(disease_.GetExposureTime() + disease_.GetFeatureIncrement());
           }
         } else {
           if (disease_.GetExposureTime() > disease_.GetMinimumExposureTime()) {
-            disease_.SetExposureTime(disease_.GetExposureTime() - kIncrementOrDecrementBy);
+            disease_.SetExposureTime(disease_.GetExposureTime() - disease_.GetFeatureIncrement());
           }
         }
         break;
@@ -301,11 +485,11 @@ void Simulator::ChangeFeatureValue(bool is_key_up) {
       case 2:  // kInfectedTime
         if (is_key_up) {
           if (disease_.GetInfectedTime() < disease_.GetMaximumInfectedTime()) {
-            disease_.SetInfectedTime(disease_.GetInfectedTime() + kIncrementOrDecrementBy);
+            disease_.SetInfectedTime(disease_.GetInfectedTime() + disease_.GetFeatureIncrement());
           }
         } else {
           if (disease_.GetInfectedTime() > disease_.GetMinimumInfectedTime()) {
-            disease_.SetInfectedTime(disease_.GetInfectedTime() - kIncrementOrDecrementBy);
+            disease_.SetInfectedTime(disease_.GetInfectedTime() - disease_.GetFeatureIncrement());
           }
         }
         break;
@@ -314,12 +498,12 @@ void Simulator::ChangeFeatureValue(bool is_key_up) {
         if (is_key_up) {
           if (disease_.GetPercentPerformingSocialDistance() < disease_.GetMaximumSocialDistancePercentage()) {
             disease_.SetPercentPerformingSocialDistance(
-                disease_.GetPercentPerformingSocialDistance() + kIncrementOrDecrementBy);
+                disease_.GetPercentPerformingSocialDistance() + disease_.GetFeatureIncrement());
           }
         } else {
           if (disease_.GetPercentPerformingSocialDistance() > disease_.GetMinimumSocialDistancePercentage()) {
             disease_.SetPercentPerformingSocialDistance(
-                disease_.GetPercentPerformingSocialDistance() - kIncrementOrDecrementBy);
+                disease_.GetPercentPerformingSocialDistance() - disease_.GetFeatureIncrement());
           }
         }
         break;
@@ -327,18 +511,12 @@ void Simulator::ChangeFeatureValue(bool is_key_up) {
       case 4:  // kInfectionRadius
         if (is_key_up) {
           if (disease_.GetRadiusOfInfection() < disease_.GetMaximumInfectionRadius()) {
-            disease_.SetRadiusOfInfection(disease_.GetRadiusOfInfection() + kIncrementOrDecrementBy);
+            disease_.SetRadiusOfInfection(disease_.GetRadiusOfInfection() + disease_.GetFeatureIncrement());
           }
         } else {
-          if (disease_.GetPercentPerformingSocialDistance() != 0) {
-            if ((disease_.GetRadiusOfInfection() > disease_.GetMinimumInfectionRadius()) &&
-                (disease_.GetRadiusOfInfection() > disease_.GetAmountOfSocialDistance() + kIncrementOrDecrementBy)) {
-              disease_.SetRadiusOfInfection(disease_.GetRadiusOfInfection() - kIncrementOrDecrementBy);
-            }
-          } else {
-            if (disease_.GetRadiusOfInfection() > disease_.GetMinimumInfectionRadius()) {
-              disease_.SetRadiusOfInfection(disease_.GetRadiusOfInfection() - kIncrementOrDecrementBy);
-            }
+          if (disease_.GetRadiusOfInfection() >
+              disease_.GetMinimumAllowedRadius(disease_.GetPercentPerformingSocialDistance())) {
+            disease_.SetRadiusOfInfection(disease_.GetRadiusOfInfection() - disease_.GetFeatureIncrement());
           }
         }
         break;
@@ -355,9 +533,13 @@ void Simulator::ChangeFeatureValue(bool is_key_up) {
 }
 
 void Simulator::Clear() {
+  StopWorker();
+
   time_passed_ = 0;
-  particles_info.clear();
-  disease_.SetPopulation(particles_info);
+  disease_.SetPopulation(vector<Disease::Person>());
+  PublishParticles();
+  TakeLatestParticles();
+  histogram_.Update(disease_.GetStatusCounts(), time_passed_);
 }
 
 // Getters
@@ -393,14 +575,38 @@ std::string Simulator::GetFeatureBeingChanged() const {
   return feature_being_changed;
 }
 
-const vector<Disease::Person>& Simulator::GetParticlesInfo() {
-  return particles_info;
+const PopulationSnapshot& Simulator::GetParticlesInfo() const {
+  return snapshots_.GetReadBuffer();
 }
 
 size_t Simulator::GetTimePassed() const {
   return time_passed_;
 }
 
+size_t Simulator::GetTicksPerFrame() const {
+  return ticks_per_frame_;
+}
+
+size_t Simulator::GetMaximumTicksPerFrame() const {
+  return kMaximumTicksPerFrame;
+}
+
+bool Simulator::GetIsRunningAtMaxSpeed() const {
+  return is_running_at_max_speed_;
+}
+
+bool Simulator::GetIsDrawingInstanced() const {
+  return particle_drawer_.GetIsInstanced();
+}
+
+bool Simulator::GetIsShowingTickProfile() const {
+  return is_showing_tick_profile_;
+}
+
+const TickProfile& Simulator::GetTickProfile() const {
+  return tick_profiles_.GetReadBuffer();
+}
+
 FeatureChangeKey Simulator::GetFeatureCurrentlyChanging() const {
   return feature_currently_being_changed_;
 }
@@ -418,7 +624,7 @@ double Simulator::GetRightMargin() {
 }
 
 double Simulator::GetYLocForEnterInstructions() {
-  double y_location = histogram_.GetYCoordinateOfLastStatusStatLabel() + kInitialYLocForFeatureStats;
+  double y_location = histogram_drawer_.GetYCoordinateOfLastStatusStatLabel() + kInitialYLocForFeatureStats;
   double y_location_for_new_line = y_location + (kNumOfFeatures) * kSpacesFromContainer;
   return y_location_for_new_line + kSpacesFromContainer + kSpacesFromContainer;
 }
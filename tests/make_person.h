@@ -0,0 +1,29 @@
+#pragma once
+
+#include <core/population.h>
+
+/*
+ * Makes a person standing still at a position, colored by their status, with
+ * every counter and flag cleared. Tests set whatever else they need on the
+ * person that's returned.
+ *
+ * @param position Where the person is
+ * @param status The person's health status
+ * @return The person
+ */
+inline disease::Person MakePerson(const vec2& position, disease::Status status) {
+  disease::Person person;
+  person.radius = 1;
+  person.position = position;
+  person.velocity = vec2(0, 0);
+  person.status = status;
+  person.color = disease::GetStatusColor(status);
+  person.continuous_exposure_time = 0;
+  person.time_infected = 0;
+  person.has_been_exposed_in_frame = false;
+  person.is_quarantined = false;
+  person.is_social_distancing = false;
+  person.is_going_to_central_location = false;
+  person.is_at_central_location = false;
+  return person;
+}
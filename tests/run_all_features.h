@@ -0,0 +1,32 @@
+#pragma once
+
+#include <core/infectious_disease.h>
+
+/*
+ * Runs a population with every feature on for the specified number of ticks.
+ *
+ * @param should_update_in_two_phases Whether to update in two phases
+ * @param num_of_threads The number of threads to update with
+ * @param reorder_interval How often the population is sorted, or 0 for never
+ * @param num_of_ticks The number of ticks to run
+ * @return The disease after the ticks have run
+ */
+inline disease::Disease RunAllFeatures(bool should_update_in_two_phases, size_t num_of_threads,
+                                       size_t reorder_interval, size_t num_of_ticks) {
+  disease::Disease disease = disease::Disease(0, 0, 580, 550, vec2(595, 380), vec2(1270, 630),
+                                              vec2(250, 290), vec2(350, 390));
+  disease.SetShouldUpdateInTwoPhases(should_update_in_two_phases);
+  disease.SetNumOfThreads(num_of_threads);
+  disease.SetReorderInterval(reorder_interval);
+  disease.SetShouldQuarantine(true);
+  disease.SetPercentPerformingSocialDistance(50);
+  disease.SetRadiusOfInfection(20);
+  disease.SetHaveCentralLocation(true);
+  disease.SetExposureTime(5);
+  disease.CreatePopulation();
+
+  for (size_t tick = 0; tick < num_of_ticks; tick++) {
+    disease.UpdateParticles();
+  }
+  return disease;
+}
@@ -0,0 +1,128 @@
+#include <core/allocation_counter.h>
+#include <core/histogram.h>
+#include <core/infectious_disease.h>
+
+#include <catch2/catch.hpp>
+
+using disease::Disease;
+using disease::GetNumOfAllocations;
+using disease::Histogram;
+using disease::Status;
+using disease::StatusCounts;
+
+namespace {
+
+size_t CountAllocations() {
+  return size_t(GetNumOfAllocations());
+}
+
+/*
+ * Runs the specified number of frames and returns how many allocations were
+ * made in total.
+ */
+size_t AllocationsToRun(Disease& disease, size_t num_of_frames) {
+  size_t allocations_before = CountAllocations();
+  for (size_t frame = 0; frame < num_of_frames; frame++) {
+    disease.UpdateParticles();
+  }
+  return CountAllocations() - allocations_before;
+}
+
+/*
+ * Updates the histogram with the specified number of frames of an outbreak
+ * and returns how many allocations were made.
+ */
+size_t AllocationsToUpdate(Histogram& histogram, size_t num_of_frames) {
+  StatusCounts status_counts;
+  status_counts[Status::kSusceptible] = 150;
+  status_counts[Status::kSymptomatic] = 50;
+
+  size_t allocations_before = CountAllocations();
+  for (size_t frame = 0; frame < num_of_frames; frame++) {
+    histogram.Update(status_counts, frame);
+  }
+  return CountAllocations() - allocations_before;
+}
+
+}  // namespace
+
+TEST_CASE("Allocations are counted") {
+  size_t allocations_before = CountAllocations();
+  vector<size_t> allocated(100, 1);
+  size_t allocations_after = CountAllocations();
+
+  REQUIRE(allocations_after == allocations_before + 1);
+  REQUIRE(allocated.back() == 1);
+}
+
+TEST_CASE("Frames don't allocate once the population is created", "[allocations]") {
+  Disease disease = Disease(0, 0, 580, 550, vec2(595, 380), vec2(1270, 630),
+                            vec2(250, 290), vec2(350, 390));
+
+  SECTION("Even the first frame, since every buffer is sized up front") {
+    disease.SetSusceptiblePopulationSize(2000);
+    disease.SetContainerBounds(0, 0, 1800, 1800);
+    disease.SetPercentPerformingSocialDistance(100);
+    disease.CreatePopulation();
+
+    REQUIRE(AllocationsToRun(disease, 1) == 0);
+  }
+
+  SECTION("Default features") {
+    disease.CreatePopulation();
+    disease.UpdateParticles();
+
+    REQUIRE(AllocationsToRun(disease, 100) == 0);
+  }
+
+  SECTION("All features on") {
+    disease.SetShouldQuarantine(true);
+    disease.SetPercentPerformingSocialDistance(100);
+    disease.SetRadiusOfInfection(45);
+    disease.SetHaveCentralLocation(true);
+    disease.CreatePopulation();
+    disease.UpdateParticles();
+
+    REQUIRE(AllocationsToRun(disease, 100) == 0);
+  }
+
+  SECTION("All features on, reordered every tick") {
+    disease.SetReorderInterval(1);
+    disease.SetShouldQuarantine(true);
+    disease.SetPercentPerformingSocialDistance(100);
+    disease.SetRadiusOfInfection(45);
+    disease.SetHaveCentralLocation(true);
+    disease.CreatePopulation();
+    disease.UpdateParticles();
+
+    REQUIRE(AllocationsToRun(disease, 100) == 0);
+  }
+
+  SECTION("All features on, updated in two phases on several threads") {
+    disease.SetShouldUpdateInTwoPhases(true);
+    disease.SetNumOfThreads(4);
+    disease.SetShouldQuarantine(true);
+    disease.SetPercentPerformingSocialDistance(100);
+    disease.SetRadiusOfInfection(45);
+    disease.SetHaveCentralLocation(true);
+    disease.CreatePopulation();
+    disease.UpdateParticles();
+
+    REQUIRE(AllocationsToRun(disease, 100) == 0);
+  }
+}
+
+TEST_CASE("Histogram updates don't allocate", "[allocations]") {
+  Histogram histogram;
+
+  SECTION("Even once the outbreak outgrows the bins and they get merged") {
+    REQUIRE(AllocationsToUpdate(histogram, 10 * Histogram::kMaximumNumOfBins) == 0);
+  }
+
+  SECTION("After the outbreak is reset") {
+    AllocationsToUpdate(histogram, 10 * Histogram::kMaximumNumOfBins);
+    histogram.Update(StatusCounts(), 0);
+
+    REQUIRE(AllocationsToUpdate(histogram, 10 * Histogram::kMaximumNumOfBins) == 0);
+  }
+}
@@ -0,0 +1,106 @@
+#include <core/batch_runner.h>
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+
+using disease::BatchRunner;
+
+namespace {
+
+vector<string> SplitLines(const string& text) {
+  vector<string> lines;
+  std::istringstream stream(text);
+  string line;
+  while (std::getline(stream, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+}  // namespace
+
+TEST_CASE("Batch runner writes the status counts of every tick") {
+  BatchRunner runner;
+  std::ostringstream output;
+
+  SECTION("No ticks only writes the starting population") {
+    runner.Run(0, output);
+
+    vector<string> lines = SplitLines(output.str());
+    REQUIRE(lines.size() == 2);
+    REQUIRE(lines[0] == "tick,susceptible,symptomatic,asymptomatic,removed");
+    REQUIRE(lines[1] == "0,200,1,0,0");
+  }
+
+  SECTION("One row per tick") {
+    runner.Run(25, output);
+
+    vector<string> lines = SplitLines(output.str());
+    REQUIRE(lines.size() == 27);
+    REQUIRE(lines.back().substr(0, 3) == "25,");
+  }
+
+  SECTION("Population size can be changed before the run") {
+    runner.GetDisease().SetSusceptiblePopulationSize(10);
+    runner.Run(0, output);
+
+    REQUIRE(SplitLines(output.str())[1] == "0,10,1,0,0");
+  }
+
+  SECTION("Runs with the same seed are the same") {
+    BatchRunner other_runner;
+    std::ostringstream other_output;
+
+    runner.GetDisease().SetSeed(42);
+    other_runner.GetDisease().SetSeed(42);
+    runner.Run(300, output);
+    other_runner.Run(300, other_output);
+
+    REQUIRE(output.str() == other_output.str());
+  }
+
+  SECTION("Runs with different seeds start differently") {
+    BatchRunner other_runner;
+    runner.GetDisease().SetSeed(1);
+    other_runner.GetDisease().SetSeed(2);
+    runner.Run(0, output);
+    other_runner.Run(0, output);
+
+    vector<disease::Person> people = runner.GetDisease().GetPopulation();
+    vector<disease::Person> other_people = other_runner.GetDisease().GetPopulation();
+    REQUIRE(people.front().position != other_people.front().position);
+  }
+
+  SECTION("A larger world fits a larger population") {
+    runner.SetWorldSize(1100, 1160);
+    runner.GetDisease().SetSusceptiblePopulationSize(800);
+    runner.GetDisease().SetHaveCentralLocation(true);
+    runner.GetDisease().SetShouldQuarantine(true);
+    runner.Run(50, output);
+
+    REQUIRE(runner.GetDisease().GetContainerBottomRight() == vec2(25 + 1100, 50 + 1160));
+    REQUIRE(SplitLines(output.str())[1] == "0,800,1,0,0");
+  }
+
+  SECTION("Everyone is counted after every tick") {
+    runner.GetDisease().SetShouldQuarantine(true);
+    runner.GetDisease().SetPercentPerformingSocialDistance(50);
+    runner.Run(100, output);
+
+    vector<string> lines = SplitLines(output.str());
+    for (size_t row = 1; row < lines.size(); row++) {
+      std::istringstream fields(lines[row]);
+      size_t tick, count, total = 0;
+      char comma;
+      fields >> tick;
+      for (size_t status = 0; status < 4; status++) {
+        fields >> comma >> count;
+        total += count;
+      }
+
+      REQUIRE(tick == row - 1);
+      REQUIRE(total == 201);
+    }
+  }
+}
@@ -0,0 +1,141 @@
+#include <core/distance_kernel.h>
+#include <core/random.h>
+
+#include <catch2/catch.hpp>
+
+using disease::FindWithinDistance;
+using disease::FindWithinDistanceSingle;
+using disease::GetSimdLevel;
+using disease::IsWithinDistance;
+using disease::IsWithinDistanceSingle;
+using disease::kDistanceBatchSize;
+using disease::Random;
+using disease::SimdLevel;
+
+namespace {
+
+/*
+ * Gets every instruction set this CPU can run the kernel on.
+ */
+std::vector<SimdLevel> GetSupportedLevels() {
+  std::vector<SimdLevel> levels = {SimdLevel::kScalar};
+  if (GetSimdLevel() >= SimdLevel::kAvx2) {
+    levels.push_back(SimdLevel::kAvx2);
+  }
+  if (GetSimdLevel() >= SimdLevel::kAvx512) {
+    levels.push_back(SimdLevel::kAvx512);
+  }
+  return levels;
+}
+
+}  // namespace
+
+TEST_CASE("Distance kernel finds the candidates within reach") {
+  SECTION("Touching counts as within reach") {
+    float candidates_x[] = {0, 30, 30.5f, 0};
+    float candidates_y[] = {0, 0, 0, -29};
+    double candidate_radii[] = {10, 10, 10, 9};
+
+    for (SimdLevel level : GetSupportedLevels()) {
+      // Reach 20 plus a radius of 10 is exactly 30 away
+      REQUIRE(FindWithinDistance(level, 0, 0, 20, candidates_x, candidates_y, candidate_radii, 4) ==
+              uint32_t(0xb));  // all but the third
+    }
+  }
+
+  SECTION("No candidates") {
+    for (SimdLevel level : GetSupportedLevels()) {
+      REQUIRE(FindWithinDistance(level, 0, 0, 20, nullptr, nullptr, nullptr, 0) == 0);
+    }
+  }
+
+  SECTION("Every instruction set agrees with the single pair check") {
+    Random random(42);
+    float candidates_x[kDistanceBatchSize];
+    float candidates_y[kDistanceBatchSize];
+    double candidate_radii[kDistanceBatchSize];
+
+    for (uint32_t trial = 0; trial < 500; trial++) {
+      size_t num_of_candidates = trial % (kDistanceBatchSize + 1);
+      float position_x = random.GetFloat(0, trial, 0, 0, 100);
+      float position_y = random.GetFloat(0, trial, 1, 0, 100);
+      double reach = random.GetFloat(0, trial, 2, 5, 30);
+
+      uint32_t expected_hits = 0;
+      for (size_t candidate = 0; candidate < num_of_candidates; candidate++) {
+        candidates_x[candidate] = random.GetFloat(candidate + 1, trial, 0, 0, 100);
+        candidates_y[candidate] = random.GetFloat(candidate + 1, trial, 1, 0, 100);
+        candidate_radii[candidate] = random.GetFloat(candidate + 1, trial, 2, 1, 20);
+        if (IsWithinDistance(position_x, position_y, reach, candidates_x[candidate],
+                             candidates_y[candidate], candidate_radii[candidate])) {
+          expected_hits |= uint32_t(1) << candidate;
+        }
+      }
+
+      for (SimdLevel level : GetSupportedLevels()) {
+        REQUIRE(FindWithinDistance(level, position_x, position_y, reach, candidates_x,
+                                   candidates_y, candidate_radii, num_of_candidates) == expected_hits);
+      }
+    }
+  }
+}
+
+TEST_CASE("Single precision distance kernel finds the candidates within reach") {
+  SECTION("Touching counts as within reach") {
+    float candidates_x[] = {0, 30, 30.5f, 0};
+    float candidates_y[] = {0, 0, 0, -29};
+    float candidate_radii[] = {10, 10, 10, 9};
+
+    for (SimdLevel level : GetSupportedLevels()) {
+      REQUIRE(FindWithinDistanceSingle(level, 0, 0, 20, candidates_x, candidates_y,
+                                       candidate_radii, 4) == uint32_t(0xb));
+    }
+  }
+
+  SECTION("No candidates") {
+    for (SimdLevel level : GetSupportedLevels()) {
+      REQUIRE(FindWithinDistanceSingle(level, 0, 0, 20, nullptr, nullptr, nullptr, 0) == 0);
+    }
+  }
+
+  SECTION("Every instruction set agrees with the single pair check") {
+    Random random(7);
+    float candidates_x[kDistanceBatchSize];
+    float candidates_y[kDistanceBatchSize];
+    float candidate_radii[kDistanceBatchSize];
+    size_t num_of_disagreements = 0;
+
+    for (uint32_t trial = 0; trial < 500; trial++) {
+      size_t num_of_candidates = trial % (kDistanceBatchSize + 1);
+      float position_x = random.GetFloat(0, trial, 0, 0, 100);
+      float position_y = random.GetFloat(0, trial, 1, 0, 100);
+      float reach = random.GetFloat(0, trial, 2, 5, 30);
+
+      uint32_t expected_hits = 0;
+      for (size_t candidate = 0; candidate < num_of_candidates; candidate++) {
+        candidates_x[candidate] = random.GetFloat(candidate + 1, trial, 0, 0, 100);
+        candidates_y[candidate] = random.GetFloat(candidate + 1, trial, 1, 0, 100);
+        candidate_radii[candidate] = random.GetFloat(candidate + 1, trial, 2, 1, 20);
+        if (IsWithinDistanceSingle(position_x, position_y, reach, candidates_x[candidate],
+                                   candidates_y[candidate], candidate_radii[candidate])) {
+          expected_hits |= uint32_t(1) << candidate;
+        }
+        if (IsWithinDistance(position_x, position_y, reach, candidates_x[candidate],
+                             candidates_y[candidate], candidate_radii[candidate]) !=
+            ((expected_hits >> candidate & 1) != 0)) {
+          num_of_disagreements++;
+        }
+      }
+
+      for (SimdLevel level : GetSupportedLevels()) {
+        REQUIRE(FindWithinDistanceSingle(level, position_x, position_y, reach, candidates_x,
+                                         candidates_y, candidate_radii,
+                                         num_of_candidates) == expected_hits);
+      }
+    }
+
+    // Only pairs right at the edge of the reach can be counted differently
+    // from double precision, which random positions almost never are
+    REQUIRE(num_of_disagreements <= 1);
+  }
+}
@@ -0,0 +1,138 @@
+#include <core/ensemble.h>
+
+#include <catch2/catch.hpp>
+
+#include <set>
+#include <sstream>
+
+using disease::Disease;
+using disease::Ensemble;
+using disease::RunningStatistics;
+using disease::Status;
+using disease::TickStatistics;
+
+TEST_CASE("Running statistics summarize their samples") {
+  SECTION("No samples") {
+    RunningStatistics statistics(10);
+
+    REQUIRE(statistics.GetNumOfSamples() == 0);
+    REQUIRE(statistics.GetMean() == 0);
+    REQUIRE(statistics.GetVariance() == 0);
+    REQUIRE(statistics.GetQuantile(0.5) == 0);
+  }
+
+  SECTION("Mean, variance, and quantiles are exact for small values") {
+    RunningStatistics statistics(100);
+    for (size_t value : {2, 4, 4, 4, 5, 5, 7, 9}) {
+      statistics.Add(value);
+    }
+
+    REQUIRE(statistics.GetNumOfSamples() == 8);
+    REQUIRE(statistics.GetMean() == Approx(5));
+    REQUIRE(statistics.GetVariance() == Approx(32.0 / 7));
+    REQUIRE(statistics.GetQuantile(0) == 2);
+    REQUIRE(statistics.GetQuantile(0.5) == 4);
+    REQUIRE(statistics.GetQuantile(0.75) == 5);
+    REQUIRE(statistics.GetQuantile(1) == 9);
+  }
+
+  SECTION("Quantiles of large values are within a bin") {
+    RunningStatistics statistics(100000);
+    for (size_t value = 0; value <= 100000; value += 10) {
+      statistics.Add(value);
+    }
+
+    double bin_width = 100000.0 / RunningStatistics::kNumOfBins;
+    REQUIRE(statistics.GetMean() == Approx(50000));
+    REQUIRE(statistics.GetQuantile(0.5) == Approx(50000).margin(bin_width));
+    REQUIRE(statistics.GetQuantile(0.95) == Approx(95000).margin(bin_width));
+  }
+
+  SECTION("Quantiles stay within the range of the samples") {
+    RunningStatistics statistics(1000);
+    for (size_t sample = 0; sample < 20; sample++) {
+      statistics.Add(201);
+    }
+
+    REQUIRE(statistics.GetQuantile(0.05) == 201);
+    REQUIRE(statistics.GetQuantile(0.95) == 201);
+  }
+
+  SECTION("Merging gives the same summary as adding every sample to one") {
+    RunningStatistics all(1000);
+    RunningStatistics first_half(1000);
+    RunningStatistics second_half(1000);
+    for (size_t value = 0; value < 1000; value += 7) {
+      all.Add(value);
+      (value % 2 == 0 ? first_half : second_half).Add(value);
+    }
+    second_half.Merge(first_half);
+
+    REQUIRE(second_half.GetNumOfSamples() == all.GetNumOfSamples());
+    REQUIRE(second_half.GetMean() == all.GetMean());
+    REQUIRE(second_half.GetVariance() == all.GetVariance());
+    REQUIRE(second_half.GetQuantile(0.05) == all.GetQuantile(0.05));
+    REQUIRE(second_half.GetQuantile(0.95) == all.GetQuantile(0.95));
+  }
+}
+
+TEST_CASE("Ensembles run independent replicates") {
+  Disease disease = Disease(0, 0, 300, 300, vec2(320, 200), vec2(600, 300),
+                            vec2(100, 100), vec2(200, 200));
+  disease.SetSusceptiblePopulationSize(50);
+  const size_t kNumOfTicks = 60;
+
+  SECTION("Replicates get distinct seeds") {
+    std::set<uint64_t> seeds;
+    for (size_t replicate = 0; replicate < 1000; replicate++) {
+      seeds.insert(Ensemble::GetReplicateSeed(disease.GetSeed(), replicate));
+    }
+
+    REQUIRE(seeds.size() == 1000);
+  }
+
+  SECTION("Every replicate is counted at every tick") {
+    Ensemble ensemble(disease);
+    ensemble.SetNumOfThreads(4);
+    ensemble.Run(12, kNumOfTicks);
+
+    REQUIRE(ensemble.GetNumOfReplicates() == 12);
+    REQUIRE(ensemble.GetTickStatistics().size() == kNumOfTicks + 1);
+    for (const TickStatistics& tick : ensemble.GetTickStatistics()) {
+      double total = 0;
+      for (const RunningStatistics& statistics : tick.statistics) {
+        REQUIRE(statistics.GetNumOfSamples() == 12);
+        total += statistics.GetMean();
+      }
+      REQUIRE(total == Approx(51));
+    }
+
+    REQUIRE(ensemble.GetTickStatistics()[0][Status::kSymptomatic].GetMean() == 1);
+    REQUIRE(ensemble.GetPeakInfectious().GetNumOfSamples() == 12);
+    REQUIRE(ensemble.GetPeakInfectious().GetMean() >= 1);
+    REQUIRE(ensemble.GetTimeToPeak().GetQuantile(1) <= kNumOfTicks);
+  }
+
+  SECTION("Replicates differ from each other") {
+    Ensemble ensemble(disease);
+    ensemble.Run(8, kNumOfTicks);
+
+    REQUIRE(ensemble.GetTickStatistics()[kNumOfTicks][Status::kSusceptible].GetVariance() > 0);
+  }
+
+  SECTION("Results don't depend on the number of threads") {
+    Ensemble one_thread(disease);
+    one_thread.Run(10, kNumOfTicks);
+
+    Ensemble several_threads(disease);
+    several_threads.SetNumOfThreads(3);
+    several_threads.Run(10, kNumOfTicks);
+
+    std::ostringstream one_thread_output;
+    std::ostringstream several_threads_output;
+    one_thread.Write(one_thread_output);
+    several_threads.Write(several_threads_output);
+
+    REQUIRE(one_thread_output.str() == several_threads_output.str());
+  }
+}
@@ -5,6 +5,7 @@
 
 #include <catch2/catch.hpp>
 
+using disease::Direction;
 using disease::Disease;
 using disease::Status;
 
@@ -63,7 +64,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -74,7 +75,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Exposure time is at (max - 1) -> Status changes to asymptomatic") {
@@ -127,7 +128,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -138,7 +139,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Exposure time is not at (max - 1)") {
@@ -187,7 +188,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -198,7 +199,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
     }
 
@@ -249,7 +250,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -260,7 +261,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Exposure time is not at (max - 1)") {
@@ -309,7 +310,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -320,7 +321,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
     }
   }
@@ -373,7 +374,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -384,7 +385,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Time infected is not at (max - 1)") {
@@ -433,7 +434,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -444,7 +445,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 11);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
     }
 
@@ -495,7 +496,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -506,7 +507,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Time infected is not at (max - 1)") {
@@ -555,7 +556,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -566,7 +567,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 11);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
     }
   }
@@ -619,7 +620,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -630,7 +631,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Time infected is not at (max - 1)") {
@@ -679,7 +680,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -690,7 +691,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 11);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
     }
 
@@ -741,7 +742,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -752,7 +753,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 0);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
 
       SECTION("Time infected is not at (max - 1)") {
@@ -801,7 +802,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[0].time_infected == 1);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
         // Particle 2
         REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -812,7 +813,7 @@ TEST_CASE("Check person status updates") {
         REQUIRE(updated_particles[1].time_infected == 11);
         REQUIRE(updated_particles[1].is_quarantined == false);
         REQUIRE(updated_particles[1].is_social_distancing == false);
-        REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
       }
     }
   }
@@ -864,7 +865,7 @@ TEST_CASE("Check person status updates") {
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(10.0, 26.0));
@@ -875,7 +876,7 @@ TEST_CASE("Check person status updates") {
       REQUIRE(updated_particles[1].time_infected == 0);
       REQUIRE(updated_particles[1].is_quarantined == false);
       REQUIRE(updated_particles[1].is_social_distancing == false);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("Person not exposed") {
@@ -924,7 +925,7 @@ TEST_CASE("Check person status updates") {
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(55.0, 21.0));
@@ -935,7 +936,7 @@ TEST_CASE("Check person status updates") {
       REQUIRE(updated_particles[1].time_infected == 0);
       REQUIRE(updated_particles[1].is_quarantined == false);
       REQUIRE(updated_particles[1].is_social_distancing == false);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
   }
 }
@@ -995,7 +996,7 @@ TEST_CASE("Check infected people get quarantined") {
     REQUIRE(updated_particles[0].time_infected == 1);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 2
     REQUIRE(updated_particles[1].position.x >= 150);
@@ -1009,7 +1010,7 @@ TEST_CASE("Check infected people get quarantined") {
     REQUIRE(updated_particles[1].time_infected == 70);
     REQUIRE(updated_particles[1].is_quarantined == true);
     REQUIRE(updated_particles[1].is_social_distancing == false);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
   }
 
   SECTION("Infection time is over the time needed to be put into quarantine") {
@@ -1058,7 +1059,7 @@ TEST_CASE("Check infected people get quarantined") {
     REQUIRE(updated_particles[0].time_infected == 1);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 2
     REQUIRE(updated_particles[1].position.x >= 150);
@@ -1072,7 +1073,7 @@ TEST_CASE("Check infected people get quarantined") {
     REQUIRE(updated_particles[1].time_infected == 490);
     REQUIRE(updated_particles[1].is_quarantined == true);
     REQUIRE(updated_particles[1].is_social_distancing == false);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
   }
 }
 
@@ -1181,7 +1182,7 @@ TEST_CASE("Check social distancing") {
       REQUIRE(updated_particles[0].time_infected == 70);
       REQUIRE(updated_particles[0].is_quarantined == true);
       REQUIRE(updated_particles[0].is_social_distancing == true);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(170, 61));
@@ -1192,7 +1193,7 @@ TEST_CASE("Check social distancing") {
       REQUIRE(updated_particles[1].time_infected == 70);
       REQUIRE(updated_particles[1].is_quarantined == true);
       REQUIRE(updated_particles[1].is_social_distancing == true);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("W/o quarantine") {
@@ -1245,10 +1246,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[0].time_infected == 0);
           REQUIRE(updated_particles[0].is_quarantined == false);
           REQUIRE(updated_particles[0].is_social_distancing == true);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["up"] == 1);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["down"] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kUp] == 1);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kDown] == 0);
 
           // Particle 2
           REQUIRE(updated_particles[1].position == vec2(70, 49));
@@ -1259,10 +1260,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[1].time_infected == 70);
           REQUIRE(updated_particles[1].is_quarantined == false);
           REQUIRE(updated_particles[1].is_social_distancing == true);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["up"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["down"] == 1);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kUp] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kDown] == 1);
         }
 
         SECTION("One of two particles are social distancing") {
@@ -1313,10 +1314,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[0].time_infected == 0);
           REQUIRE(updated_particles[0].is_quarantined == false);
           REQUIRE(updated_particles[0].is_social_distancing == true);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["up"] == 1);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["down"] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kUp] == 1);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kDown] == 0);
 
           // Particle 2
           REQUIRE(updated_particles[1].position == vec2(70, 61));
@@ -1327,7 +1328,7 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[1].time_infected == 70);
           REQUIRE(updated_particles[1].is_quarantined == false);
           REQUIRE(updated_particles[1].is_social_distancing == false);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
         }
       }
 
@@ -1395,10 +1396,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[0].time_infected == 0);
           REQUIRE(updated_particles[0].is_quarantined == false);
           REQUIRE(updated_particles[0].is_social_distancing == true);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["up"] == 1);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["down"] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kUp] == 1);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kDown] == 0);
 
           // Particle 2
           REQUIRE(updated_particles[1].position == vec2(80, 49));
@@ -1409,10 +1410,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[1].time_infected == 70);
           REQUIRE(updated_particles[1].is_quarantined == false);
           REQUIRE(updated_particles[1].is_social_distancing == true);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["left"] == 1);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["up"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["down"] == 1);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kLeft] == 1);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kUp] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kDown] == 1);
 
           // Particle 3
           REQUIRE(updated_particles[2].position == vec2(50, 61));
@@ -1423,10 +1424,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[2].time_infected == 70);
           REQUIRE(updated_particles[2].is_quarantined == false);
           REQUIRE(updated_particles[2].is_social_distancing == true);
-          REQUIRE(updated_particles[2].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[2].positions_of_people_in_bubble["right"] == 1);
-          REQUIRE(updated_particles[2].positions_of_people_in_bubble["up"] == 0);
-          REQUIRE(updated_particles[2].positions_of_people_in_bubble["down"] == 0);
+          REQUIRE(updated_particles[2].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[2].positions_of_people_in_bubble[Direction::kRight] == 1);
+          REQUIRE(updated_particles[2].positions_of_people_in_bubble[Direction::kUp] == 0);
+          REQUIRE(updated_particles[2].positions_of_people_in_bubble[Direction::kDown] == 0);
         }
 
         SECTION("One of three particles are social distancing") {
@@ -1492,10 +1493,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[0].time_infected == 0);
           REQUIRE(updated_particles[0].is_quarantined == false);
           REQUIRE(updated_particles[0].is_social_distancing == true);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["up"] == 1);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["down"] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kUp] == 1);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kDown] == 0);
 
           // Particle 2
           REQUIRE(updated_particles[1].position == vec2(80, 49));
@@ -1506,10 +1507,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[1].time_infected == 70);
           REQUIRE(updated_particles[1].is_quarantined == false);
           REQUIRE(updated_particles[1].is_social_distancing == true);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["left"] == 1);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["up"] == 0);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble["down"] == 1);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kLeft] == 1);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kUp] == 0);
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kDown] == 1);
 
           // Particle 3
           REQUIRE(updated_particles[2].position == vec2(50, 61));
@@ -1520,7 +1521,7 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[2].time_infected == 70);
           REQUIRE(updated_particles[2].is_quarantined == false);
           REQUIRE(updated_particles[2].is_social_distancing == false);
-          REQUIRE(updated_particles[2].positions_of_people_in_bubble.empty());
+          REQUIRE(updated_particles[2].positions_of_people_in_bubble.IsEmpty());
         }
 
         SECTION("Two of three particles are social distancing") {
@@ -1586,10 +1587,10 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[0].time_infected == 0);
           REQUIRE(updated_particles[0].is_quarantined == false);
           REQUIRE(updated_particles[0].is_social_distancing == true);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["left"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["right"] == 0);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["up"] == 1);
-          REQUIRE(updated_particles[0].positions_of_people_in_bubble["down"] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kLeft] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kRight] == 0);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kUp] == 1);
+          REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kDown] == 0);
 
           // Particle 2
           REQUIRE(updated_particles[1].position == vec2(70, 61));
@@ -1600,7 +1601,7 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[1].time_infected == 70);
           REQUIRE(updated_particles[1].is_quarantined == false);
           REQUIRE(updated_particles[1].is_social_distancing == false);
-          REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+          REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
 
           // Particle 3
           REQUIRE(updated_particles[2].position == vec2(50, 61));
@@ -1611,7 +1612,7 @@ TEST_CASE("Check social distancing") {
           REQUIRE(updated_particles[2].time_infected == 70);
           REQUIRE(updated_particles[2].is_quarantined == false);
           REQUIRE(updated_particles[2].is_social_distancing == false);
-          REQUIRE(updated_particles[2].positions_of_people_in_bubble.empty());
+          REQUIRE(updated_particles[2].positions_of_people_in_bubble.IsEmpty());
         }
       }
     }
@@ -1656,7 +1657,7 @@ TEST_CASE("Check wall collisions w/ central location") {
       REQUIRE(updated_particles[0].time_infected == 0);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(updated_particles[0].is_going_to_central_location == false);
       REQUIRE(updated_particles[0].is_at_central_location == true);
     }
@@ -1696,7 +1697,7 @@ TEST_CASE("Check wall collisions w/ central location") {
       REQUIRE(updated_particles[0].time_infected == 0);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(updated_particles[0].is_going_to_central_location == false);
       REQUIRE(updated_particles[0].is_at_central_location == false);
     }
@@ -1733,7 +1734,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1756,7 +1757,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1779,7 +1780,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1802,7 +1803,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1839,7 +1840,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == true);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1862,7 +1863,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == true);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1885,7 +1886,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == true);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1908,7 +1909,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == true);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1946,7 +1947,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1969,7 +1970,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -1992,7 +1993,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -2015,7 +2016,7 @@ TEST_CASE("Check wall collisions w/ central location") {
         REQUIRE(updated_particles[0].time_infected == 0);
         REQUIRE(updated_particles[0].is_quarantined == false);
         REQUIRE(updated_particles[0].is_social_distancing == false);
-        REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+        REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
         REQUIRE(updated_particles[0].is_going_to_central_location == false);
         REQUIRE(updated_particles[0].is_at_central_location == false);
       }
@@ -2068,7 +2069,7 @@ TEST_CASE("Check particle updates properly w/ a central location") {
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(updated_particles[0].is_going_to_central_location == true);
       REQUIRE(updated_particles[0].is_at_central_location == false);
     }
@@ -2094,7 +2095,7 @@ TEST_CASE("Check particle updates properly w/ a central location") {
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(updated_particles[0].is_going_to_central_location == false);
       REQUIRE(updated_particles[0].is_at_central_location == false);
     }
@@ -2131,7 +2132,7 @@ TEST_CASE("Check particle updates properly w/ a central location") {
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(updated_particles[0].is_going_to_central_location == false);
       REQUIRE(updated_particles[0].is_at_central_location == false);
     }
@@ -2157,7 +2158,7 @@ TEST_CASE("Check particle updates properly w/ a central location") {
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(updated_particles[0].is_going_to_central_location == false);
       REQUIRE(updated_particles[0].is_at_central_location == true);
     }
@@ -2196,7 +2197,7 @@ TEST_CASE("Check particle updates properly w/ a central location") {
     REQUIRE(updated_particles[0].time_infected == 0);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     REQUIRE(updated_particles[0].is_going_to_central_location == false);
     REQUIRE(updated_particles[0].is_at_central_location == true);
   }
@@ -2236,7 +2237,7 @@ TEST_CASE("Check particle updates properly w/ a central location") {
     REQUIRE(updated_particles[0].time_infected == 70);
     REQUIRE(updated_particles[0].is_quarantined == true);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     REQUIRE(updated_particles[0].is_going_to_central_location == false);
     REQUIRE(updated_particles[0].is_at_central_location == false);
   }
@@ -2289,10 +2290,10 @@ TEST_CASE("Check particle updates properly w/ a central location") {
     REQUIRE(updated_particles[0].time_infected == 0);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == true);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble["left"] == 0);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble["right"] == 0);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble["up"] == 1);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble["down"] == 0);
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kLeft] == 0);
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kRight] == 0);
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kUp] == 1);
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble[Direction::kDown] == 0);
 
     // Particle 2
     REQUIRE(updated_particles[1].position == vec2(49.5, 47.4));
@@ -2303,9 +2304,9 @@ TEST_CASE("Check particle updates properly w/ a central location") {
     REQUIRE(updated_particles[1].time_infected == 70);
     REQUIRE(updated_particles[1].is_quarantined == false);
     REQUIRE(updated_particles[1].is_social_distancing == true);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble["left"] == 0);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble["right"] == 0);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble["up"] == 0);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble["down"] == 1);
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kLeft] == 0);
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kRight] == 0);
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kUp] == 0);
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble[Direction::kDown] == 1);
   }
 }
\ No newline at end of file
@@ -8,8 +8,9 @@
 using disease::Disease;
 using disease::Histogram;
 using disease::Status;
+using disease::StatusCounts;
 
-TEST_CASE("Check people get sorted according to health status") {
+TEST_CASE("Check people get counted according to health status") {
   Histogram histogram;
   Disease::Person person;
 
@@ -22,12 +23,12 @@ TEST_CASE("Check people get sorted according to health status") {
       all_particles.push_back(person);
     }
 
-    histogram.SortPopulation(all_particles);
+    histogram.CountPopulation(all_particles);
 
-    map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+    StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-    REQUIRE(histogram.GetSortedPopulation().size() == 1);
-    REQUIRE(actual_sorted_people[Status::kSusceptible].size() == 3);
+    REQUIRE(histogram.GetStatusCounts().GetTotal() == 3);
+    REQUIRE(actual_status_counts[Status::kSusceptible] == 3);
   }
 
   SECTION("Two status types (susceptible and symptomatic)") {
@@ -43,13 +44,13 @@ TEST_CASE("Check people get sorted according to health status") {
     person.color = vec3(1,0,0);
     all_particles.push_back(person);
 
-    histogram.SortPopulation(all_particles);
+    histogram.CountPopulation(all_particles);
 
-    map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+    StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-    REQUIRE(histogram.GetSortedPopulation().size() == 2);
-    REQUIRE(actual_sorted_people[Status::kSusceptible].size() == 3);
-    REQUIRE(actual_sorted_people[Status::kSymptomatic].size() == 1);
+    REQUIRE(histogram.GetStatusCounts().GetTotal() == 4);
+    REQUIRE(actual_status_counts[Status::kSusceptible] == 3);
+    REQUIRE(actual_status_counts[Status::kSymptomatic] == 1);
   }
 
   SECTION("Two status types (susceptible and symptomatic), unordered") {
@@ -69,13 +70,13 @@ TEST_CASE("Check people get sorted according to health status") {
     person.color = vec3(1,0,0);
     all_particles.push_back(person);
 
-    histogram.SortPopulation(all_particles);
+    histogram.CountPopulation(all_particles);
 
-    map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+    StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-    REQUIRE(histogram.GetSortedPopulation().size() == 2);
-    REQUIRE(actual_sorted_people[Status::kSusceptible].size() == 3);
-    REQUIRE(actual_sorted_people[Status::kSymptomatic].size() == 2);
+    REQUIRE(histogram.GetStatusCounts().GetTotal() == 5);
+    REQUIRE(actual_status_counts[Status::kSusceptible] == 3);
+    REQUIRE(actual_status_counts[Status::kSymptomatic] == 2);
   }
 
   SECTION("Three status types (susceptible, symptomatic, asymptomatic)") {
@@ -95,14 +96,14 @@ TEST_CASE("Check people get sorted according to health status") {
     person.color = vec3(1,1,0);
     all_particles.push_back(person);
 
-    histogram.SortPopulation(all_particles);
+    histogram.CountPopulation(all_particles);
 
-    map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+    StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-    REQUIRE(histogram.GetSortedPopulation().size() == 3);
-    REQUIRE(actual_sorted_people[Status::kSusceptible].size() == 3);
-    REQUIRE(actual_sorted_people[Status::kSymptomatic].size() == 1);
-    REQUIRE(actual_sorted_people[Status::kAsymptomatic].size() == 1);
+    REQUIRE(histogram.GetStatusCounts().GetTotal() == 5);
+    REQUIRE(actual_status_counts[Status::kSusceptible] == 3);
+    REQUIRE(actual_status_counts[Status::kSymptomatic] == 1);
+    REQUIRE(actual_status_counts[Status::kAsymptomatic] == 1);
   }
 }
 
@@ -124,7 +125,7 @@ TEST_CASE("Check population get updated") {
       person.color = vec3(1,0,0);
       existing_people.push_back(person);
 
-      histogram.SortPopulation(existing_people);
+      histogram.CountPopulation(existing_people);
 
       vector<Disease::Person> updated_people;
 
@@ -144,13 +145,13 @@ TEST_CASE("Check population get updated") {
 
       histogram.Update(updated_people, 10);
 
-      map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+      StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-      REQUIRE(actual_sorted_people.size() == 3);
-      REQUIRE(actual_sorted_people[Status::kSusceptible].size() == 1);
-      REQUIRE(actual_sorted_people[Status::kSymptomatic].size() == 2);
-      REQUIRE(actual_sorted_people[Status::kRemoved].size() == 1);
-      REQUIRE(histogram.GetCumulativeInfoOfPopulation().size() == 1);
+      REQUIRE(actual_status_counts.GetTotal() == 4);
+      REQUIRE(actual_status_counts[Status::kSusceptible] == 1);
+      REQUIRE(actual_status_counts[Status::kSymptomatic] == 2);
+      REQUIRE(actual_status_counts[Status::kRemoved] == 1);
+      REQUIRE(histogram.GetBins().size() == 1);
       REQUIRE(histogram.GetTimeElapsedSinceOutbreak() == 10);
     }
 
@@ -170,14 +171,14 @@ TEST_CASE("Check population get updated") {
         existing_people.push_back(person);
       }
 
-      histogram.SortPopulation(existing_people);
+      histogram.CountPopulation(existing_people);
 
-      map<Status, vector<Disease::Person>> sorted_people = histogram.GetSortedPopulation();
+      StatusCounts status_counts = histogram.GetStatusCounts();
 
-      REQUIRE(sorted_people.size() == 2);
-      REQUIRE(sorted_people[Status::kSusceptible].size() == 1);
-      REQUIRE(sorted_people[Status::kRemoved].size() == 3);
-      REQUIRE(histogram.GetCumulativeInfoOfPopulation().size() == 0);
+      REQUIRE(status_counts.GetTotal() == 4);
+      REQUIRE(status_counts[Status::kSusceptible] == 1);
+      REQUIRE(status_counts[Status::kRemoved] == 3);
+      REQUIRE(histogram.GetBins().empty());
       REQUIRE(histogram.GetTimeElapsedSinceOutbreak() == Approx(0.0).margin(0.01));
 
       vector<Disease::Person> updated_people;
@@ -194,12 +195,12 @@ TEST_CASE("Check population get updated") {
 
       histogram.Update(updated_people, 10);
 
-      map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+      StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-      REQUIRE(actual_sorted_people.size() == 4);
-      REQUIRE(actual_sorted_people[Status::kSusceptible].size() == 1);
-      REQUIRE(actual_sorted_people[Status::kRemoved].size() == 3);
-      REQUIRE(histogram.GetCumulativeInfoOfPopulation().size() == 0);
+      REQUIRE(actual_status_counts.GetNumOfInfectious() == 0);
+      REQUIRE(actual_status_counts[Status::kSusceptible] == 1);
+      REQUIRE(actual_status_counts[Status::kRemoved] == 3);
+      REQUIRE(histogram.GetBins().empty());
       REQUIRE(histogram.GetTimeElapsedSinceOutbreak() == Approx(0.0).margin(0.01));
     }
   }
@@ -220,17 +221,78 @@ TEST_CASE("Check population get updated") {
     person.color = vec3(1,0,0);
     existing_people.push_back(person);
 
-    histogram.SortPopulation(existing_people);
+    histogram.CountPopulation(existing_people);
 
     vector<Disease::Person> updated_people;
     REQUIRE(updated_people.size() == 0);
 
     histogram.Update(updated_people, 0);
 
-    map<Status, vector<Disease::Person>> actual_sorted_people = histogram.GetSortedPopulation();
+    StatusCounts actual_status_counts = histogram.GetStatusCounts();
 
-    REQUIRE(actual_sorted_people.size() == 0);
-    REQUIRE(histogram.GetCumulativeInfoOfPopulation().size() == 0);
+    REQUIRE(actual_status_counts.GetTotal() == 0);
+    REQUIRE(histogram.GetBins().empty());
     REQUIRE(histogram.GetTimeElapsedSinceOutbreak() == 0);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Check frames get downsampled into a bounded number of bins") {
+  Histogram histogram;
+  StatusCounts status_counts;
+  status_counts[Status::kSusceptible] = 3;
+  status_counts[Status::kSymptomatic] = 1;
+
+  SECTION("One bin per frame until the bins run out") {
+    for (size_t time = 1; time <= Histogram::kMaximumNumOfBins; time++) {
+      histogram.Update(status_counts, time);
+    }
+
+    REQUIRE(histogram.GetBins().size() == Histogram::kMaximumNumOfBins);
+    REQUIRE(histogram.GetFramesPerBin() == 1);
+    REQUIRE(histogram.GetBins().back().GetAverage(Status::kSymptomatic) == Approx(1));
+  }
+
+  SECTION("Bins merge in pairs once there are too many") {
+    size_t layout_version = histogram.GetBinLayoutVersion();
+
+    for (size_t time = 1; time <= Histogram::kMaximumNumOfBins + 1; time++) {
+      status_counts[Status::kSymptomatic] = time % 2;
+      status_counts[Status::kAsymptomatic] = 1 - time % 2;
+      histogram.Update(status_counts, time);
+    }
+
+    REQUIRE(histogram.GetBins().size() == Histogram::kMaximumNumOfBins / 2 + 1);
+    REQUIRE(histogram.GetFramesPerBin() == 2);
+    REQUIRE(histogram.GetBinLayoutVersion() != layout_version);
+    REQUIRE(histogram.GetBins().front().num_of_frames == 2);
+    REQUIRE(histogram.GetBins().front().GetAverage(Status::kSymptomatic) == Approx(0.5));
+    REQUIRE(histogram.GetBins().back().num_of_frames == 1);
+  }
+
+  SECTION("Every frame is kept in some bin") {
+    size_t num_of_frames = 10 * Histogram::kMaximumNumOfBins + 7;
+    for (size_t time = 1; time <= num_of_frames; time++) {
+      histogram.Update(status_counts, time);
+    }
+
+    size_t num_of_frames_in_bins = 0;
+    for (const disease::HistogramBin& bin : histogram.GetBins()) {
+      num_of_frames_in_bins += bin.num_of_frames;
+    }
+
+    REQUIRE(histogram.GetBins().size() <= Histogram::kMaximumNumOfBins);
+    REQUIRE(histogram.GetBins().size() > Histogram::kMaximumNumOfBins / 4);
+    REQUIRE(num_of_frames_in_bins == num_of_frames);
+  }
+
+  SECTION("Clearing the population removes the bins") {
+    histogram.Update(status_counts, 1);
+    size_t layout_version = histogram.GetBinLayoutVersion();
+
+    histogram.Update(StatusCounts(), 0);
+
+    REQUIRE(histogram.GetBins().empty());
+    REQUIRE(histogram.GetFramesPerBin() == 1);
+    REQUIRE(histogram.GetBinLayoutVersion() != layout_version);
+  }
+}
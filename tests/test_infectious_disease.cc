@@ -33,7 +33,7 @@ TEST_CASE("Create population", "[create population]") {
       REQUIRE(all_particles[i].has_been_exposed_in_frame == false);
       REQUIRE(all_particles[i].is_quarantined == false);
       REQUIRE(all_particles[i].is_social_distancing == false);
-      REQUIRE(all_particles[i].positions_of_people_in_bubble.empty());
+      REQUIRE(all_particles[i].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(all_particles[i].is_going_to_central_location == false);
       REQUIRE(all_particles[i].is_at_central_location == false);
     }
@@ -55,7 +55,7 @@ TEST_CASE("Create population", "[create population]") {
     REQUIRE(all_particles[all_particles.size() - 1].has_been_exposed_in_frame == false);
     REQUIRE(all_particles[all_particles.size() - 1].is_quarantined == false);
     REQUIRE(all_particles[all_particles.size() - 1].is_social_distancing == false);
-    REQUIRE(all_particles[all_particles.size() - 1].positions_of_people_in_bubble.empty());
+    REQUIRE(all_particles[all_particles.size() - 1].positions_of_people_in_bubble.IsEmpty());
     REQUIRE(all_particles[all_particles.size() - 1].is_going_to_central_location == false);
     REQUIRE(all_particles[all_particles.size() - 1].is_at_central_location == false);
   }
@@ -88,7 +88,7 @@ TEST_CASE("Create population", "[create population]") {
       REQUIRE(all_particles[i].has_been_exposed_in_frame == false);
       REQUIRE(all_particles[i].is_quarantined == false);
       REQUIRE(all_particles[i].is_social_distancing == false);
-      REQUIRE(all_particles[i].positions_of_people_in_bubble.empty());
+      REQUIRE(all_particles[i].positions_of_people_in_bubble.IsEmpty());
       REQUIRE(all_particles[i].is_going_to_central_location == false);
       REQUIRE(all_particles[i].is_at_central_location == false);
     }
@@ -110,10 +110,36 @@ TEST_CASE("Create population", "[create population]") {
     REQUIRE(all_particles[all_particles.size() - 1].has_been_exposed_in_frame == false);
     REQUIRE(all_particles[all_particles.size() - 1].is_quarantined == false);
     REQUIRE(all_particles[all_particles.size() - 1].is_social_distancing == false);
-    REQUIRE(all_particles[all_particles.size() - 1].positions_of_people_in_bubble.empty());
+    REQUIRE(all_particles[all_particles.size() - 1].positions_of_people_in_bubble.IsEmpty());
     REQUIRE(all_particles[all_particles.size() - 1].is_going_to_central_location == false);
     REQUIRE(all_particles[all_particles.size() - 1].is_at_central_location == false);
   }
+
+  SECTION("Population size, particle radius, and container set at runtime") {
+    Disease disease = Disease(0, 0, 100, 100, vec2(150, 0), vec2(250, 100),
+                              vec2(45, 45), vec2(55, 55));
+    disease.SetSusceptiblePopulationSize(1000);
+    disease.SetParticleRadius(2.5);
+    disease.SetContainerBounds(10, 20, 300, 400);
+
+    disease.CreatePopulation();
+
+    REQUIRE(disease.GetContainerTopLeft() == vec2(10, 20));
+    REQUIRE(disease.GetContainerBottomRight() == vec2(410, 320));
+
+    vector<Disease::Person> all_particles = disease.GetPopulation();
+    REQUIRE(all_particles.size() == 1001);
+
+    size_t num_outside_of_container = 0;
+    for (const Disease::Person& person : all_particles) {
+      REQUIRE(person.radius == Approx(2.5));
+      if (person.position.x < 10 || person.position.x > 410 ||
+          person.position.y < 20 || person.position.y > 320) {
+        num_outside_of_container++;
+      }
+    }
+    REQUIRE(num_outside_of_container == 0);
+  }
 }
 
 TEST_CASE("Person info updates after 1 frame (no collision)",
@@ -160,7 +186,7 @@ TEST_CASE("Person info updates after 1 frame (no collision)",
     REQUIRE(updated_particles[0].time_infected == 1);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
   }
 
   SECTION("Two particles") {
@@ -209,7 +235,7 @@ TEST_CASE("Person info updates after 1 frame (no collision)",
     REQUIRE(updated_particles[0].time_infected == 1);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 2
     REQUIRE(updated_particles[1].position == vec2(50.0, 36.0));
@@ -220,7 +246,7 @@ TEST_CASE("Person info updates after 1 frame (no collision)",
     REQUIRE(updated_particles[1].time_infected == 0);
     REQUIRE(updated_particles[1].is_quarantined == false);
     REQUIRE(updated_particles[1].is_social_distancing == false);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
   }
 
   SECTION("Three particles") {
@@ -284,7 +310,7 @@ TEST_CASE("Person info updates after 1 frame (no collision)",
     REQUIRE(updated_particles[0].time_infected == 1);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 2
     REQUIRE(updated_particles[1].position == vec2(50.0, 36.0));
@@ -295,7 +321,7 @@ TEST_CASE("Person info updates after 1 frame (no collision)",
     REQUIRE(updated_particles[1].time_infected == 0);
     REQUIRE(updated_particles[1].is_quarantined == false);
     REQUIRE(updated_particles[1].is_social_distancing == false);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 3
     REQUIRE(updated_particles[2].position == vec2(62.3, 83.4));
@@ -306,7 +332,7 @@ TEST_CASE("Person info updates after 1 frame (no collision)",
     REQUIRE(updated_particles[2].time_infected == 0);
     REQUIRE(updated_particles[2].is_quarantined == false);
     REQUIRE(updated_particles[2].is_social_distancing == false);
-    REQUIRE(updated_particles[2].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[2].positions_of_people_in_bubble.IsEmpty());
   }
 }
 
@@ -354,7 +380,7 @@ TEST_CASE("Person info updates after 2 frames (no collision)",
     REQUIRE(updated_particles[0].time_infected == 2);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
   }
 
   SECTION("Two particles") {
@@ -404,7 +430,7 @@ TEST_CASE("Person info updates after 2 frames (no collision)",
     REQUIRE(updated_particles[0].time_infected == 2);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 2
     REQUIRE(updated_particles[1].position == vec2(45.0, 42.0));
@@ -415,7 +441,7 @@ TEST_CASE("Person info updates after 2 frames (no collision)",
     REQUIRE(updated_particles[1].time_infected == 0);
     REQUIRE(updated_particles[1].is_quarantined == false);
     REQUIRE(updated_particles[1].is_social_distancing == false);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
   }
 
   SECTION("Three particles") {
@@ -480,7 +506,7 @@ TEST_CASE("Person info updates after 2 frames (no collision)",
     REQUIRE(updated_particles[0].time_infected == 2);
     REQUIRE(updated_particles[0].is_quarantined == false);
     REQUIRE(updated_particles[0].is_social_distancing == false);
-    REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 2
     REQUIRE(updated_particles[1].position == vec2(45.0, 42.0));
@@ -491,7 +517,7 @@ TEST_CASE("Person info updates after 2 frames (no collision)",
     REQUIRE(updated_particles[1].time_infected == 0);
     REQUIRE(updated_particles[1].is_quarantined == false);
     REQUIRE(updated_particles[1].is_social_distancing == false);
-    REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
 
     // Particle 3
     REQUIRE(updated_particles[2].position == vec2(54.6, 86.8));
@@ -502,7 +528,7 @@ TEST_CASE("Person info updates after 2 frames (no collision)",
     REQUIRE(updated_particles[2].time_infected == 0);
     REQUIRE(updated_particles[2].is_quarantined == false);
     REQUIRE(updated_particles[2].is_social_distancing == false);
-    REQUIRE(updated_particles[2].positions_of_people_in_bubble.empty());
+    REQUIRE(updated_particles[2].positions_of_people_in_bubble.IsEmpty());
   }
 }
 
@@ -542,7 +568,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle collides with bottom wall") {
@@ -574,7 +600,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle collides with left wall") {
@@ -605,7 +631,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].continuous_exposure_time == 0);
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle collides with top wall") {
@@ -637,7 +663,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle collides with two walls at once") {
@@ -669,7 +695,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
   }
 
@@ -720,7 +746,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(35.0, 83.0));
@@ -731,7 +757,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[1].time_infected == 0);
       REQUIRE(updated_particles[1].is_quarantined == false);
       REQUIRE(updated_particles[1].is_social_distancing == false);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One of two particles collide with a wall in a frame") {
@@ -780,7 +806,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(35.0, 57.0));
@@ -791,7 +817,7 @@ TEST_CASE("Person info updates after collision with wall",
       REQUIRE(updated_particles[1].time_infected == 1);
       REQUIRE(updated_particles[1].is_quarantined == false);
       REQUIRE(updated_particles[1].is_social_distancing == false);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
   }
 }
@@ -832,7 +858,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle touches but doesn't collide with bottom wall") {
@@ -864,7 +890,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle touches but doesn't collide with left wall") {
@@ -896,7 +922,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle touches but doesn't collide with top wall") {
@@ -928,7 +954,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One particle touches but doesn't collide with two walls at once") {
@@ -960,7 +986,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
     }
   }
 
@@ -1011,7 +1037,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(35.0, 83.0));
@@ -1022,7 +1048,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[1].time_infected == 0);
       REQUIRE(updated_particles[1].is_quarantined == false);
       REQUIRE(updated_particles[1].is_social_distancing == false);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
 
     SECTION("One of two particles touches but doesn't collide with a wall in a frame") {
@@ -1071,7 +1097,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[0].time_infected == 1);
       REQUIRE(updated_particles[0].is_quarantined == false);
       REQUIRE(updated_particles[0].is_social_distancing == false);
-      REQUIRE(updated_particles[0].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[0].positions_of_people_in_bubble.IsEmpty());
 
       // Particle 2
       REQUIRE(updated_particles[1].position == vec2(35.0, 57.0));
@@ -1082,7 +1108,7 @@ TEST_CASE("Particle touches wall but isn't colliding (i.e. moving towards)",
       REQUIRE(updated_particles[1].time_infected == 1);
       REQUIRE(updated_particles[1].is_quarantined == false);
       REQUIRE(updated_particles[1].is_social_distancing == false);
-      REQUIRE(updated_particles[1].positions_of_people_in_bubble.empty());
+      REQUIRE(updated_particles[1].positions_of_people_in_bubble.IsEmpty());
     }
   }
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <core/parameter_sweep.h>
+
+#include <catch2/catch.hpp>
+
+#include <set>
+#include <sstream>
+
+using disease::Disease;
+using disease::FeatureSettings;
+using disease::ParameterSweep;
+using disease::Status;
+using disease::SweepResult;
+
+namespace {
+
+Disease CreateSmallDisease() {
+  Disease disease = Disease(0, 0, 300, 300, vec2(320, 200), vec2(600, 300),
+                            vec2(100, 100), vec2(200, 200));
+  disease.SetSusceptiblePopulationSize(40);
+  return disease;
+}
+
+}  // namespace
+
+TEST_CASE("Parameter sweeps cover the features the simulator allows") {
+  Disease disease = CreateSmallDisease();
+  ParameterSweep sweep(disease);
+
+  SECTION("Feature values step by the feature increment") {
+    REQUIRE(sweep.GetFeatureValues(5, 50) == vector<size_t>({5, 10, 15, 20, 25, 30, 35, 40, 45, 50}));
+  }
+
+  SECTION("The radius of infection has to reach past social distancing bubbles") {
+    REQUIRE(disease.GetMinimumAllowedRadius(0) == disease.GetMinimumInfectionRadius());
+    REQUIRE(disease.GetMinimumAllowedRadius(50) ==
+            disease.GetAmountOfSocialDistance() + disease.GetFeatureIncrement());
+  }
+
+  SECTION("The grid has every allowed combination once") {
+    vector<FeatureSettings> grid = sweep.GetGrid();
+
+    // 10 exposure times, 101 infected times, and 2 quarantine and central
+    // location values, with 9 radii when nobody social distances and 8 (none
+    // below 10) for each of the 20 other social distance values
+    REQUIRE(grid.size() == 10 * 101 * 2 * 2 * (9 + 20 * 8));
+
+    std::set<std::string> unique_settings;
+    size_t num_of_disallowed_settings = 0;
+    for (const FeatureSettings& settings : grid) {
+      if (settings.exposure_time < disease.GetMinimumExposureTime() ||
+          settings.exposure_time > disease.GetMaximumExposureTime() ||
+          settings.infected_time < disease.GetMinimumInfectedTime() ||
+          settings.infected_time > disease.GetMaximumInfectedTime() ||
+          (settings.percent_performing_social_distance != 0 && settings.radius_of_infection < 10)) {
+        num_of_disallowed_settings++;
+      }
+
+      std::ostringstream key;
+      key << settings.should_quarantine << settings.exposure_time << ',' << settings.infected_time
+          << ',' << settings.percent_performing_social_distance << ','
+          << settings.radius_of_infection << settings.have_central_location;
+      unique_settings.insert(key.str());
+    }
+    REQUIRE(num_of_disallowed_settings == 0);
+    REQUIRE(unique_settings.size() == grid.size());
+  }
+
+  SECTION("A Latin hypercube uses every stratum of each feature once") {
+    const size_t kNumOfSamples = 101;
+    vector<FeatureSettings> samples = sweep.GetLatinHypercube(kNumOfSamples, 7);
+
+    REQUIRE(samples.size() == kNumOfSamples);
+
+    // With as many samples as infected times, each infected time is used once
+    std::set<size_t> infected_times;
+    size_t num_quarantining = 0;
+    for (const FeatureSettings& settings : samples) {
+      infected_times.insert(settings.infected_time);
+      num_quarantining += settings.should_quarantine;
+      if (settings.percent_performing_social_distance != 0) {
+        REQUIRE(settings.radius_of_infection >= 10);
+      }
+    }
+    REQUIRE(infected_times.size() == kNumOfSamples);
+    REQUIRE(num_quarantining >= 50);
+    REQUIRE(num_quarantining <= 51);
+  }
+
+  SECTION("The same seed gives the same sample") {
+    vector<FeatureSettings> first = sweep.GetLatinHypercube(20, 3);
+    vector<FeatureSettings> second = sweep.GetLatinHypercube(20, 3);
+
+    for (size_t sample = 0; sample < first.size(); sample++) {
+      REQUIRE(first[sample].exposure_time == second[sample].exposure_time);
+      REQUIRE(first[sample].radius_of_infection == second[sample].radius_of_infection);
+    }
+  }
+}
+
+TEST_CASE("Parameter sweeps run each setting") {
+  Disease disease = CreateSmallDisease();
+  ParameterSweep sweep(disease);
+  vector<FeatureSettings> settings = sweep.GetLatinHypercube(6, 11);
+
+  SECTION("Results are the same as running the disease with the settings") {
+    vector<SweepResult> results = sweep.Run(settings, 40);
+
+    REQUIRE(results.size() == settings.size());
+    for (size_t run = 0; run < settings.size(); run++) {
+      Disease expected = disease;
+      settings[run].ApplyTo(expected);
+      expected.CreatePopulation();
+      for (size_t tick = 0; tick < results[run].num_of_ticks_run; tick++) {
+        expected.UpdateParticles();
+      }
+
+      REQUIRE(results[run].num_of_ticks_run <= 40);
+      REQUIRE(results[run].final_counts[Status::kSusceptible] ==
+              expected.GetStatusCounts()[Status::kSusceptible]);
+      REQUIRE(results[run].final_counts[Status::kRemoved] ==
+              expected.GetStatusCounts()[Status::kRemoved]);
+      REQUIRE(results[run].peak_infectious >= 1);
+    }
+  }
+
+  SECTION("Results don't depend on the number of threads") {
+    ParameterSweep several_threads(disease);
+    several_threads.SetNumOfThreads(3);
+
+    std::ostringstream one_thread_output;
+    std::ostringstream several_threads_output;
+    sweep.Write(settings, sweep.Run(settings, 40), one_thread_output);
+    several_threads.Write(settings, several_threads.Run(settings, 40), several_threads_output);
+
+    REQUIRE(one_thread_output.str() == several_threads_output.str());
+  }
+
+  SECTION("One row per run") {
+    std::ostringstream output;
+    sweep.Write(settings, sweep.Run(settings, 10), output);
+
+    std::istringstream lines(output.str());
+    string line;
+    size_t num_of_lines = 0;
+    while (std::getline(lines, line)) {
+      num_of_lines++;
+    }
+    REQUIRE(num_of_lines == settings.size() + 1);
+  }
+}
@@ -0,0 +1,209 @@
+#include <core/population.h>
+#include <core/population_snapshot.h>
+
+#include <catch2/catch.hpp>
+
+#include "make_person.h"
+
+using disease::Person;
+using disease::Population;
+using disease::PopulationSnapshot;
+using disease::Status;
+
+TEST_CASE("Population stores people as arrays") {
+  Population population;
+
+  SECTION("Empty population") {
+    REQUIRE(population.Size() == 0);
+    REQUIRE(population.IsEmpty());
+    REQUIRE(population.ToVector().empty());
+  }
+
+  SECTION("Added person's info is split across the arrays") {
+    Person person = MakePerson(vec2(15, 20), Status::kAsymptomatic);
+    person.velocity = vec2(-5, 6);
+    person.continuous_exposure_time = 3;
+    person.time_infected = 4;
+    population.Add(person);
+
+    REQUIRE(population.Size() == 1);
+    REQUIRE(population.position_x[0] == 15);
+    REQUIRE(population.position_y[0] == 20);
+    REQUIRE(population.velocity_x[0] == -5);
+    REQUIRE(population.velocity_y[0] == 6);
+    REQUIRE(population.status[0] == Status::kAsymptomatic);
+    REQUIRE(population.continuous_exposure_time[0] == 3);
+    REQUIRE(population.time_infected[0] == 4);
+  }
+
+  SECTION("Person info is the same after being gathered from the arrays") {
+    Person added_person = MakePerson(vec2(30, 40), Status::kSymptomatic);
+    added_person.radius = 10;
+    added_person.velocity = vec2(-5, 6);
+    added_person.color = vec3(0, 0, 1);
+    added_person.continuous_exposure_time = 3;
+    added_person.time_infected = 4;
+    added_person.has_been_exposed_in_frame = true;
+    added_person.is_social_distancing = true;
+    added_person.is_at_central_location = true;
+
+    population.Add(MakePerson(vec2(15, 20), Status::kSusceptible));
+    population.Add(added_person);
+
+    Person person = population.GetPerson(1);
+
+    REQUIRE(person.radius == 10);
+    REQUIRE(person.position == vec2(30, 40));
+    REQUIRE(person.velocity == vec2(-5, 6));
+    REQUIRE(person.status == Status::kSymptomatic);
+    REQUIRE(person.color == vec3(0, 0, 1));
+    REQUIRE(person.continuous_exposure_time == 3);
+    REQUIRE(person.time_infected == 4);
+    REQUIRE(person.has_been_exposed_in_frame == true);
+    REQUIRE(person.is_quarantined == false);
+    REQUIRE(person.is_social_distancing == true);
+    REQUIRE(person.is_going_to_central_location == false);
+    REQUIRE(person.is_at_central_location == true);
+  }
+
+  SECTION("Setting a person only changes that person") {
+    population.Add(MakePerson(vec2(15, 20), Status::kSusceptible));
+    population.Add(MakePerson(vec2(30, 40), Status::kSusceptible));
+
+    population.SetPerson(0, MakePerson(vec2(1, 2), Status::kRemoved));
+
+    vector<Person> people = population.ToVector();
+    REQUIRE(people.size() == 2);
+    REQUIRE(people[0].position == vec2(1, 2));
+    REQUIRE(people[0].status == Status::kRemoved);
+    REQUIRE(people[1].position == vec2(30, 40));
+    REQUIRE(people[1].status == Status::kSusceptible);
+  }
+
+  SECTION("People are given ids in the order they're added") {
+    population.Add(MakePerson(vec2(15, 20), Status::kSusceptible));
+    population.Add(MakePerson(vec2(30, 40), Status::kSusceptible));
+
+    REQUIRE(population.id == vector<uint32_t>{0, 1});
+    REQUIRE(population.GetIndex(1) == 1);
+  }
+
+  SECTION("Reordering moves everyone's info and id together") {
+    for (size_t person = 0; person < 5; person++) {
+      population.Add(MakePerson(vec2(person, 0), Status::kSusceptible));
+    }
+
+    // A cycle of three people, a swap, and someone who stays put
+    vector<size_t> order = {2, 0, 1, 4, 3};
+    population.Reorder(order);
+
+    REQUIRE(order == vector<size_t>{0, 1, 2, 3, 4});
+    REQUIRE(population.id == vector<uint32_t>{2, 0, 1, 4, 3});
+    REQUIRE(population.position_x == vector<float>{2, 0, 1, 4, 3});
+    REQUIRE(population.index_of_id == vector<uint32_t>{1, 2, 0, 4, 3});
+
+    vector<Person> people = population.ToVector();
+    for (size_t person = 0; person < 5; person++) {
+      REQUIRE(people[person].position == vec2(person, 0));
+    }
+  }
+
+  SECTION("Clearing removes everyone") {
+    population.Add(MakePerson(vec2(15, 20), Status::kSusceptible));
+    population.Clear();
+
+    REQUIRE(population.IsEmpty());
+    REQUIRE(population.position_x.empty());
+    REQUIRE(population.positions_of_people_in_bubble.empty());
+  }
+}
+
+TEST_CASE("Bubble counts keep one counter per direction") {
+  disease::BubbleCounts bubble;
+
+  SECTION("Counts start empty") {
+    REQUIRE(bubble.IsEmpty());
+    REQUIRE(bubble[disease::Direction::kUp] == 0);
+    REQUIRE(bubble[disease::Direction::kRight] == 0);
+  }
+
+  SECTION("Each direction is counted separately") {
+    bubble[disease::Direction::kUp] += 2;
+    bubble[disease::Direction::kLeft] += 1;
+
+    REQUIRE(bubble.IsEmpty() == false);
+    REQUIRE(bubble[disease::Direction::kUp] == 2);
+    REQUIRE(bubble[disease::Direction::kDown] == 0);
+    REQUIRE(bubble[disease::Direction::kLeft] == 1);
+    REQUIRE(bubble[disease::Direction::kRight] == 0);
+  }
+
+  SECTION("Clearing resets every direction") {
+    bubble[disease::Direction::kDown] += 3;
+    bubble.Clear();
+
+    REQUIRE(bubble.IsEmpty());
+  }
+}
+
+TEST_CASE("Status counts keep one counter per health status") {
+  disease::StatusCounts status_counts;
+
+  SECTION("Counts start at 0") {
+    REQUIRE(status_counts.GetTotal() == 0);
+    REQUIRE(status_counts.GetNumOfInfectious() == 0);
+  }
+
+  SECTION("Infectious people are symptomatic or asymptomatic") {
+    status_counts[Status::kSusceptible] = 5;
+    status_counts[Status::kSymptomatic] = 2;
+    status_counts[Status::kAsymptomatic] = 1;
+    status_counts[Status::kRemoved] = 3;
+
+    REQUIRE(status_counts.GetTotal() == 11);
+    REQUIRE(status_counts.GetNumOfInfectious() == 3);
+  }
+
+  SECTION("Clearing resets every status") {
+    status_counts[Status::kRemoved] = 3;
+    status_counts.Clear();
+
+    REQUIRE(status_counts.GetTotal() == 0);
+  }
+}
+
+TEST_CASE("Population snapshots copy what's needed to draw people") {
+  Population population;
+  population.Add(MakePerson(vec2(15, 20), Status::kAsymptomatic));
+  population.Add(MakePerson(vec2(30, 40), Status::kRemoved));
+
+  PopulationSnapshot snapshot;
+  REQUIRE(snapshot.IsEmpty());
+
+  snapshot.CopyFrom(population);
+
+  SECTION("Everyone is copied in population order") {
+    REQUIRE(snapshot.Size() == 2);
+    REQUIRE(snapshot.position[1] == vec2(30, 40));
+    REQUIRE(snapshot.radius[1] == 1);
+    REQUIRE(snapshot.color[1] == disease::GetStatusColor(Status::kRemoved));
+    REQUIRE(snapshot.status[1] == Status::kRemoved);
+  }
+
+  SECTION("Copying again overwrites the previous copy") {
+    population.SetPosition(0, vec2(1, 2));
+    population.Add(MakePerson(vec2(45, 60), Status::kSusceptible));
+    snapshot.CopyFrom(population);
+
+    REQUIRE(snapshot.Size() == 3);
+    REQUIRE(snapshot.position[0] == vec2(1, 2));
+    REQUIRE(snapshot.status[2] == Status::kSusceptible);
+  }
+
+  SECTION("Copying an empty population empties the snapshot") {
+    population.Clear();
+    snapshot.CopyFrom(population);
+
+    REQUIRE(snapshot.IsEmpty());
+  }
+}
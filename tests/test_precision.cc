@@ -0,0 +1,85 @@
+#include <core/ensemble.h>
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+using disease::Disease;
+using disease::Ensemble;
+using disease::RunningStatistics;
+using disease::Status;
+
+namespace {
+
+/*
+ * Checks if two sets of samples have means within the specified number of
+ * standard errors of their difference (plus a small margin, so two identical
+ * sets with no variance pass).
+ */
+bool HaveEquivalentMeans(const RunningStatistics& first, const RunningStatistics& second,
+                         double num_of_standard_errors) {
+  double standard_error = std::sqrt(first.GetVariance() / first.GetNumOfSamples() +
+                                    second.GetVariance() / second.GetNumOfSamples());
+  return std::abs(first.GetMean() - second.GetMean()) <=
+         num_of_standard_errors * standard_error + 0.5;
+}
+
+/*
+ * Runs the same replicates of the disease in double and single precision, and
+ * checks that the counts every 50 ticks, peak number of infectious people, and
+ * time to peak have equivalent means.
+ */
+void RequireEquivalentEpidemics(Disease disease) {
+  const size_t kNumOfReplicates = 40;
+  const size_t kNumOfTicks = 300;
+  const double kNumOfStandardErrors = 4;
+
+  disease.SetPrecision(Disease::Precision::kDouble);
+  Ensemble double_precision(disease);
+  double_precision.Run(kNumOfReplicates, kNumOfTicks);
+
+  disease.SetPrecision(Disease::Precision::kSingle);
+  Ensemble single_precision(disease);
+  single_precision.Run(kNumOfReplicates, kNumOfTicks);
+
+  for (size_t tick = 0; tick <= kNumOfTicks; tick += 50) {
+    for (Status status : {Status::kSusceptible, Status::kSymptomatic, Status::kAsymptomatic,
+                          Status::kRemoved}) {
+      INFO("tick " << tick << ", status " << size_t(status));
+      REQUIRE(HaveEquivalentMeans(double_precision.GetTickStatistics()[tick][status],
+                                  single_precision.GetTickStatistics()[tick][status],
+                                  kNumOfStandardErrors));
+    }
+  }
+
+  REQUIRE(HaveEquivalentMeans(double_precision.GetPeakInfectious(),
+                              single_precision.GetPeakInfectious(), kNumOfStandardErrors));
+  REQUIRE(HaveEquivalentMeans(double_precision.GetTimeToPeak(),
+                              single_precision.GetTimeToPeak(), kNumOfStandardErrors));
+}
+
+}  // namespace
+
+TEST_CASE("Single precision epidemics are statistically the same as double precision ones",
+          "[precision]") {
+  Disease disease = Disease(0, 0, 300, 300, vec2(320, 200), vec2(600, 300),
+                            vec2(100, 100), vec2(200, 200));
+  disease.SetSusceptiblePopulationSize(100);
+  disease.SetExposureTime(15);
+  disease.SetInfectedTime(250);
+
+  SECTION("The default is double precision") {
+    REQUIRE(disease.GetPrecision() == Disease::Precision::kDouble);
+  }
+
+  SECTION("Default features") {
+    RequireEquivalentEpidemics(disease);
+  }
+
+  SECTION("Social distancing, quarantine, and a larger radius of infection") {
+    disease.SetPercentPerformingSocialDistance(50);
+    disease.SetShouldQuarantine(true);
+    disease.SetRadiusOfInfection(25);
+    RequireEquivalentEpidemics(disease);
+  }
+}
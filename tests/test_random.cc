@@ -0,0 +1,58 @@
+#include <core/random.h>
+
+#include <catch2/catch.hpp>
+
+using disease::Random;
+
+TEST_CASE("Random values only depend on the seed and where they're drawn from") {
+  Random random(7);
+
+  SECTION("Same seed and position give the same value") {
+    Random other_random(7);
+
+    REQUIRE(random.GetFloat(3, 10, 2, 0, 1) == other_random.GetFloat(3, 10, 2, 0, 1));
+  }
+
+  SECTION("Drawing other values doesn't change a value") {
+    float value = random.GetFloat(3, 10, 2, 0, 1);
+    for (uint32_t draw = 0; draw < 100; draw++) {
+      random.GetFloat(5, 11, draw, 0, 1);
+    }
+
+    REQUIRE(random.GetFloat(3, 10, 2, 0, 1) == value);
+  }
+
+  SECTION("Different seeds, streams, steps, and draws give different values") {
+    float value = random.GetFloat(3, 10, 2, 0, 1);
+
+    REQUIRE(Random(8).GetFloat(3, 10, 2, 0, 1) != value);
+    REQUIRE(random.GetFloat(4, 10, 2, 0, 1) != value);
+    REQUIRE(random.GetFloat(3, 11, 2, 0, 1) != value);
+    REQUIRE(random.GetFloat(3, 10, 3, 0, 1) != value);
+  }
+
+  SECTION("Seed can be changed") {
+    random.SetSeed(8);
+
+    REQUIRE(random.GetSeed() == 8);
+    REQUIRE(random.GetFloat(3, 10, 2, 0, 1) == Random(8).GetFloat(3, 10, 2, 0, 1));
+  }
+}
+
+TEST_CASE("Random values are uniform between the bounds") {
+  Random random;
+  const size_t kNumOfValues = 100000;
+  double sum = 0;
+  size_t num_out_of_bounds = 0;
+
+  for (size_t stream = 0; stream < kNumOfValues; stream++) {
+    float value = random.GetFloat(stream, 0, 0, -2, 6);
+    if (value < -2 || value > 6) {
+      num_out_of_bounds++;
+    }
+    sum += value;
+  }
+
+  REQUIRE(num_out_of_bounds == 0);
+  REQUIRE(sum / kNumOfValues == Approx(2).margin(0.05));
+}
@@ -0,0 +1,154 @@
+#include <core/infectious_disease.h>
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+#include "make_person.h"
+#include "run_all_features.h"
+
+using disease::Disease;
+using disease::Status;
+using disease::StatusCounts;
+using disease::StatusTransition;
+
+namespace {
+
+/*
+ * Gets the average distance between people who are next to each other in
+ * the population.
+ */
+double AverageDistanceToNextPerson(const Disease& disease) {
+  const disease::Population& population = disease.GetPopulationData();
+  double total_distance = 0;
+  for (size_t index = 1; index < population.Size(); index++) {
+    vec2 difference = population.GetPosition(index) - population.GetPosition(index - 1);
+    total_distance += std::sqrt(difference.x * difference.x + difference.y * difference.y);
+  }
+  return total_distance / (population.Size() - 1);
+}
+
+}  // namespace
+
+TEST_CASE("Reordering the population keeps everyone's info with their id") {
+  Disease disease = Disease(0, 0, 100, 100, vec2(150, 0), vec2(250, 100),
+                            vec2(45, 45), vec2(55, 55));
+  disease.SetShouldUpdateInTwoPhases(true);
+
+  vector<Disease::Person> people;
+  people.push_back(MakePerson(vec2(90, 90), Status::kRemoved));
+  people.push_back(MakePerson(vec2(10, 10), Status::kRemoved));
+  people.push_back(MakePerson(vec2(90, 10), Status::kRemoved));
+  people.push_back(MakePerson(vec2(10, 90), Status::kRemoved));
+  disease.SetPopulation(people);
+
+  SECTION("The population isn't reordered by default") {
+    REQUIRE(disease.GetReorderInterval() == 0);
+    disease.UpdateParticles();
+
+    REQUIRE(disease.GetPopulationData().id == vector<uint32_t>{0, 1, 2, 3});
+  }
+
+  SECTION("People are sorted along a Morton curve, but found by id") {
+    disease.SetReorderInterval(1);
+    disease.UpdateParticles();
+
+    // Top left, top right, bottom left, bottom right
+    REQUIRE(disease.GetPopulationData().id == vector<uint32_t>{1, 2, 3, 0});
+
+    vector<Disease::Person> updated_people = disease.GetPopulation();
+    for (size_t id = 0; id < people.size(); id++) {
+      REQUIRE(updated_people[id].position == people[id].position);
+    }
+  }
+
+  SECTION("The population is only reordered every interval") {
+    disease.SetReorderInterval(2);
+    disease.UpdateParticles();
+    REQUIRE(disease.GetPopulationData().id == vector<uint32_t>{0, 1, 2, 3});
+
+    disease.UpdateParticles();
+    REQUIRE(disease.GetPopulationData().id == vector<uint32_t>{1, 2, 3, 0});
+  }
+}
+
+TEST_CASE("Reordering puts people near each other next to each other") {
+  Disease disease = Disease(0, 0, 1800, 1800, vec2(1900, 0), vec2(2200, 300),
+                            vec2(850, 850), vec2(950, 950));
+  disease.SetSusceptiblePopulationSize(2000);
+  disease.CreatePopulation();
+  double distance_before = AverageDistanceToNextPerson(disease);
+
+  disease.SetReorderInterval(1);
+  disease.UpdateParticles();
+
+  REQUIRE(AverageDistanceToNextPerson(disease) < distance_before / 10);
+}
+
+TEST_CASE("Two phase updates are the same however the population is ordered") {
+  vector<Disease::Person> unordered_people = RunAllFeatures(true, 1, 0, 300).GetPopulation();
+
+  for (size_t reorder_interval : {1, 7}) {
+    vector<Disease::Person> people = RunAllFeatures(true, 1, reorder_interval, 300).GetPopulation();
+
+    bool is_same = true;
+    for (size_t id = 0; id < people.size(); id++) {
+      is_same = is_same && people[id].position == unordered_people[id].position &&
+                people[id].velocity == unordered_people[id].velocity &&
+                people[id].status == unordered_people[id].status &&
+                people[id].time_infected == unordered_people[id].time_infected;
+    }
+
+    INFO("reorder interval: " << reorder_interval);
+    REQUIRE(people.size() == unordered_people.size());
+    REQUIRE(is_same);
+  }
+}
+
+TEST_CASE("Serial updates keep the status counts right when reordering") {
+  Disease disease = RunAllFeatures(false, 1, 5, 300);
+
+  StatusCounts status_counts;
+  for (const Disease::Person& person : disease.GetPopulation()) {
+    status_counts[person.status]++;
+  }
+
+  for (size_t status = 0; status < StatusCounts::kNumOfStatuses; status++) {
+    REQUIRE(disease.GetStatusCounts().counts[status] == status_counts.counts[status]);
+  }
+  REQUIRE(status_counts[Status::kSusceptible] < 200);
+}
+
+TEST_CASE("People can be followed by id while the population is reordered") {
+  Disease disease = RunAllFeatures(false, 1, 1, 0);
+  vector<Disease::Person> people = disease.GetPopulation();
+  const disease::Population& population = disease.GetPopulationData();
+
+  for (size_t tick = 0; tick < 200; tick++) {
+    disease.UpdateParticles();
+
+    size_t num_of_misplaced = 0;
+    for (uint32_t id = 0; id < population.Size(); id++) {
+      size_t index = disease.GetIndexOfId(id);
+      Disease::Person person = disease.GetPersonById(id);
+      if (population.id[index] != id || person.position != population.GetPosition(index)) {
+        num_of_misplaced++;
+      }
+      people[id] = person;
+    }
+    REQUIRE(num_of_misplaced == 0);
+
+    // Each status change is recorded with who changed, not just where they were
+    for (const StatusTransition& transition : disease.GetStatusTransitions()) {
+      REQUIRE(population.id[transition.index] == transition.id);
+      REQUIRE(people[transition.id].status == transition.to);
+    }
+  }
+
+  // Make sure people were actually moved
+  size_t num_of_people_moved = 0;
+  for (uint32_t id = 0; id < population.Size(); id++) {
+    num_of_people_moved += disease.GetIndexOfId(id) != id ? 1 : 0;
+  }
+  REQUIRE(num_of_people_moved > 0);
+}
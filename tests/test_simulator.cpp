@@ -5,6 +5,9 @@
 
 #include <catch2/catch.hpp>
 
+#include <chrono>
+#include <thread>
+
 using disease::visualizer::Simulator;
 
 TEST_CASE("Check member variables update") {
@@ -15,14 +18,14 @@ TEST_CASE("Check member variables update") {
 
     simulator.Update();
 
-    REQUIRE(simulator.GetParticlesInfo().size() == 201);
+    REQUIRE(simulator.GetParticlesInfo().Size() == 201);
     REQUIRE(simulator.GetTimePassed() == 1);
   }
 
   SECTION("Population has not been created") {
     simulator.Update();
 
-    REQUIRE(simulator.GetParticlesInfo().size() == 0);
+    REQUIRE(simulator.GetParticlesInfo().Size() == 0);
     REQUIRE(simulator.GetTimePassed() == 0);
   }
 }
@@ -272,11 +275,11 @@ TEST_CASE("Check member variables clear") {
 
   simulator.CreatePopulation();
   simulator.Update();
-  REQUIRE(simulator.GetParticlesInfo().size() == 201);
+  REQUIRE(simulator.GetParticlesInfo().Size() == 201);
   REQUIRE(simulator.GetTimePassed() == 1);
 
   simulator.Clear();
-  REQUIRE(simulator.GetParticlesInfo().size() == 0);
+  REQUIRE(simulator.GetParticlesInfo().Size() == 0);
   REQUIRE(simulator.GetTimePassed() == 0);
 }
 
@@ -312,4 +315,121 @@ TEST_CASE("Check GetFeatureBeingChanged() works") {
     REQUIRE(simulator.GetFeatureCurrentlyChanging() == disease::FeatureChangeKey::kInfectionRadius);
     REQUIRE(simulator.GetFeatureBeingChanged() == "'Radius of Infection'");
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Check ticks run at a fixed rate") {
+  Simulator simulator;
+  simulator.CreatePopulation();
+
+  SECTION("One tick per frame") {
+    simulator.Advance(1.0 / 60);
+
+    REQUIRE(simulator.GetTimePassed() == 1);
+    REQUIRE(simulator.GetParticlesInfo().Size() == 201);
+  }
+
+  SECTION("Short frames add up to a tick") {
+    simulator.Advance(1.0 / 240);
+    REQUIRE(simulator.GetTimePassed() == 0);
+
+    simulator.Advance(1.0 / 240);
+    simulator.Advance(1.0 / 120);
+    REQUIRE(simulator.GetTimePassed() == 1);
+  }
+
+  SECTION("Ticks per frame multiplies the rate") {
+    simulator.SetTicksPerFrame(8);
+    simulator.Advance(1.0 / 60);
+
+    REQUIRE(simulator.GetTicksPerFrame() == 8);
+    REQUIRE(simulator.GetTimePassed() == 8);
+  }
+
+  SECTION("Ticks per frame stays within bounds") {
+    simulator.SetTicksPerFrame(0);
+    REQUIRE(simulator.GetTicksPerFrame() == 1);
+
+    simulator.SetTicksPerFrame(100000);
+    REQUIRE(simulator.GetTicksPerFrame() == simulator.GetMaximumTicksPerFrame());
+  }
+
+  SECTION("A long frame only catches up on a few frames") {
+    simulator.Advance(10);
+
+    REQUIRE(simulator.GetTimePassed() > 0);
+    REQUIRE(simulator.GetTimePassed() <= 4);
+  }
+}
+
+TEST_CASE("Check max speed runs ticks in the background") {
+  Simulator simulator;
+  simulator.SetIsRunningAtMaxSpeed(true);
+  REQUIRE(simulator.GetIsRunningAtMaxSpeed());
+
+  simulator.CreatePopulation();
+  for (size_t frame = 0; frame < 1000 && simulator.GetTimePassed() < 100; frame++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    simulator.Advance(1.0 / 60);
+  }
+
+  REQUIRE(simulator.GetTimePassed() >= 100);
+  REQUIRE(simulator.GetParticlesInfo().Size() == 201);
+
+  SECTION("Stopping keeps every tick that ran") {
+    simulator.SetIsRunningAtMaxSpeed(false);
+    size_t time_passed = simulator.GetTimePassed();
+
+    simulator.Advance(1.0 / 60);
+    REQUIRE(simulator.GetTimePassed() == time_passed + 1);
+  }
+
+  SECTION("Stopping takes the particles from the last tick") {
+    simulator.SetIsRunningAtMaxSpeed(false);
+    vector<Disease::Person> population = simulator.GetDiseaseClass().GetPopulation();
+
+    REQUIRE(simulator.GetParticlesInfo().Size() == population.size());
+    REQUIRE(simulator.GetParticlesInfo().position.back() == population.back().position);
+  }
+
+  SECTION("Ticks pause while nothing is drawn and pick up again after") {
+    // Long enough for the queue of untaken ticks to fill up
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    simulator.Advance(1.0 / 60);
+    size_t time_passed = simulator.GetTimePassed();
+
+    for (size_t frame = 0; frame < 1000 && simulator.GetTimePassed() == time_passed; frame++) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      simulator.Advance(1.0 / 60);
+    }
+    REQUIRE(simulator.GetTimePassed() > time_passed);
+
+    // The worker has to wake up to be stopped if it's waiting for room
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    simulator.SetIsRunningAtMaxSpeed(false);
+    REQUIRE_FALSE(simulator.GetIsRunningAtMaxSpeed());
+  }
+
+  SECTION("Clearing stops the background thread") {
+    simulator.Clear();
+
+    REQUIRE(simulator.GetTimePassed() == 0);
+    REQUIRE(simulator.GetParticlesInfo().IsEmpty());
+    REQUIRE(simulator.GetDiseaseClass().GetPopulation().empty());
+  }
+}
+
+TEST_CASE("Check particles can be drawn one by one instead of instanced") {
+  Simulator simulator;
+
+  SECTION("Instancing is on by default") {
+    REQUIRE(simulator.GetIsDrawingInstanced());
+  }
+
+  SECTION("Instancing can be turned off and back on") {
+    simulator.SetIsDrawingInstanced(false);
+    REQUIRE_FALSE(simulator.GetIsDrawingInstanced());
+
+    simulator.SetIsDrawingInstanced(true);
+    REQUIRE(simulator.GetIsDrawingInstanced());
+  }
+}
@@ -0,0 +1,135 @@
+#include <core/single_producer_queue.h>
+#include <core/triple_buffer.h>
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+
+using disease::SingleProducerQueue;
+using disease::TripleBuffer;
+
+TEST_CASE("Triple buffer hands over the latest published value") {
+  TripleBuffer<int> buffer;
+
+  SECTION("Nothing to take before publishing") {
+    REQUIRE_FALSE(buffer.TakeLatest());
+  }
+
+  SECTION("Published value can be read once taken") {
+    buffer.GetWriteBuffer() = 5;
+    buffer.Publish();
+
+    REQUIRE(buffer.TakeLatest());
+    REQUIRE(buffer.GetReadBuffer() == 5);
+    REQUIRE_FALSE(buffer.TakeLatest());
+    REQUIRE(buffer.GetReadBuffer() == 5);
+  }
+
+  SECTION("Values published in between takes are skipped") {
+    for (int value = 1; value <= 3; value++) {
+      buffer.GetWriteBuffer() = value;
+      buffer.Publish();
+    }
+
+    REQUIRE(buffer.TakeLatest());
+    REQUIRE(buffer.GetReadBuffer() == 3);
+  }
+
+  SECTION("Writer never gets the buffer being read") {
+    buffer.GetWriteBuffer() = 1;
+    buffer.Publish();
+    buffer.TakeLatest();
+
+    for (int value = 2; value <= 10; value++) {
+      buffer.GetWriteBuffer() = value;
+      buffer.Publish();
+      REQUIRE(buffer.GetReadBuffer() == 1);
+    }
+  }
+
+  SECTION("Reader only sees whole values while the writer runs") {
+    TripleBuffer<std::vector<int>> vectors;
+    const int kNumOfPublishes = 20000;
+
+    std::thread writer([&vectors, kNumOfPublishes]() {
+      for (int value = 1; value <= kNumOfPublishes; value++) {
+        vectors.GetWriteBuffer().assign(64, value);
+        vectors.Publish();
+      }
+    });
+
+    int last_value = 0;
+    size_t num_of_torn_values = 0;
+    while (last_value < kNumOfPublishes) {
+      if (vectors.TakeLatest()) {
+        const std::vector<int>& values = vectors.GetReadBuffer();
+        for (int value : values) {
+          if (value != values.front()) {
+            num_of_torn_values++;
+          }
+        }
+        REQUIRE(values.front() > last_value);
+        last_value = values.front();
+      }
+    }
+    writer.join();
+
+    REQUIRE(num_of_torn_values == 0);
+  }
+}
+
+TEST_CASE("Single producer queue pops values in the order pushed") {
+  SingleProducerQueue<int> queue(3);
+  int value = 0;
+
+  SECTION("Empty queue has nothing to pop") {
+    REQUIRE(queue.GetCapacity() == 3);
+    REQUIRE_FALSE(queue.IsFull());
+    REQUIRE_FALSE(queue.TryPop(value));
+  }
+
+  SECTION("Full queue refuses to push until a value is popped") {
+    REQUIRE(queue.TryPush(1));
+    REQUIRE(queue.TryPush(2));
+    REQUIRE(queue.TryPush(3));
+    REQUIRE(queue.IsFull());
+    REQUIRE_FALSE(queue.TryPush(4));
+
+    REQUIRE(queue.TryPop(value));
+    REQUIRE(value == 1);
+    REQUIRE(queue.TryPush(4));
+
+    for (int expected = 2; expected <= 4; expected++) {
+      REQUIRE(queue.TryPop(value));
+      REQUIRE(value == expected);
+    }
+    REQUIRE_FALSE(queue.TryPop(value));
+  }
+
+  SECTION("Every value gets across between threads") {
+    SingleProducerQueue<int> shared_queue(16);
+    const int kNumOfValues = 100000;
+
+    std::thread producer([&shared_queue, kNumOfValues]() {
+      for (int next = 1; next <= kNumOfValues;) {
+        if (shared_queue.TryPush(next)) {
+          next++;
+        }
+      }
+    });
+
+    int expected = 1;
+    size_t num_out_of_order = 0;
+    while (expected <= kNumOfValues) {
+      if (shared_queue.TryPop(value)) {
+        if (value != expected) {
+          num_out_of_order++;
+        }
+        expected++;
+      }
+    }
+    producer.join();
+
+    REQUIRE(num_out_of_order == 0);
+  }
+}
@@ -0,0 +1,114 @@
+#include <core/spatial_grid.h>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+
+using disease::SpatialGrid;
+
+namespace {
+
+void Rebuild(SpatialGrid& grid, const vector<vec2>& positions, double cell_size) {
+  vector<float> positions_x;
+  vector<float> positions_y;
+  for (const vec2& position : positions) {
+    positions_x.push_back(position.x);
+    positions_y.push_back(position.y);
+  }
+  grid.Rebuild(positions_x, positions_y, cell_size);
+}
+
+vector<size_t> CollectNeighbors(const SpatialGrid& grid, const vec2& position) {
+  vector<size_t> neighbors;
+  grid.ForEachNeighbor(position, [&](size_t index) {
+    neighbors.push_back(index);
+    return true;
+  });
+  std::sort(neighbors.begin(), neighbors.end());
+  return neighbors;
+}
+
+}  // namespace
+
+TEST_CASE("Spatial grid is built around the positions") {
+  SpatialGrid grid;
+
+  SECTION("No positions") {
+    Rebuild(grid, vector<vec2>(), 10);
+
+    REQUIRE(grid.GetNumOfColumns() == 0);
+    REQUIRE(grid.GetNumOfRows() == 0);
+    REQUIRE(CollectNeighbors(grid, vec2(0, 0)).empty());
+  }
+
+  SECTION("Grid covers all positions") {
+    vector<vec2> positions = {vec2(0, 0), vec2(25, 0), vec2(0, 15), vec2(25, 15)};
+    Rebuild(grid, positions, 10);
+
+    REQUIRE(grid.GetCellSize() == 10);
+    REQUIRE(grid.GetNumOfColumns() == 3);
+    REQUIRE(grid.GetNumOfRows() == 2);
+  }
+
+  SECTION("Cells grow when the positions are spread far apart") {
+    vector<vec2> positions = {vec2(0, 0), vec2(1000, 1000)};
+    Rebuild(grid, positions, 10);
+
+    REQUIRE(grid.GetNumOfColumns() * grid.GetNumOfRows() <= 8);
+    REQUIRE(grid.GetCellSize() > 10);
+  }
+}
+
+TEST_CASE("Spatial grid finds neighbors") {
+  SpatialGrid grid;
+
+  SECTION("Only people in neighboring cells are visited") {
+    vector<vec2> positions = {vec2(5, 5), vec2(12, 5), vec2(35, 5), vec2(5, 28)};
+    Rebuild(grid, positions, 10);
+
+    REQUIRE(CollectNeighbors(grid, vec2(5, 5)) == vector<size_t>({0, 1}));
+    REQUIRE(CollectNeighbors(grid, vec2(35, 5)) == vector<size_t>({2}));
+    REQUIRE(CollectNeighbors(grid, vec2(5, 28)) == vector<size_t>({3}));
+  }
+
+  SECTION("Positions outside of the grid still find nearby people") {
+    vector<vec2> positions = {vec2(0, 0), vec2(50, 50)};
+    Rebuild(grid, positions, 10);
+
+    REQUIRE(CollectNeighbors(grid, vec2(-5, -5)) == vector<size_t>({0}));
+    REQUIRE(CollectNeighbors(grid, vec2(-500, -500)).empty());
+  }
+
+  SECTION("Everyone within one cell size is visited") {
+    vector<vec2> positions;
+    for (size_t i = 0; i < 400; i++) {
+      positions.push_back(vec2(float((i * 37) % 200), float((i * 91) % 150)));
+    }
+    Rebuild(grid, positions, 12);
+
+    for (size_t current = 0; current < positions.size(); current++) {
+      vector<size_t> neighbors = CollectNeighbors(grid, positions[current]);
+
+      for (size_t other = 0; other < positions.size(); other++) {
+        vec2 difference = positions[current] - positions[other];
+        if (sqrt(dot(difference, difference)) <= 12) {
+          REQUIRE(std::binary_search(neighbors.begin(), neighbors.end(), other));
+        }
+      }
+    }
+  }
+
+  SECTION("Visiting stops when the visitor returns false") {
+    vector<vec2> positions = {vec2(0, 0), vec2(1, 1), vec2(2, 2)};
+    Rebuild(grid, positions, 10);
+
+    size_t num_visited = 0;
+    bool visited_everyone = grid.ForEachNeighbor(vec2(0, 0), [&](size_t) {
+      num_visited++;
+      return false;
+    });
+
+    REQUIRE(visited_everyone == false);
+    REQUIRE(num_visited == 1);
+  }
+}
@@ -0,0 +1,149 @@
+#include <core/infectious_disease.h>
+
+#include <catch2/catch.hpp>
+
+#include "make_person.h"
+
+using disease::Disease;
+using disease::Status;
+using disease::StatusCounts;
+using disease::StatusTransition;
+using disease::StatusTransitions;
+
+namespace {
+
+/*
+ * Counts everyone's status by going through the whole population.
+ */
+StatusCounts CountEveryone(const Disease& disease) {
+  StatusCounts status_counts;
+  for (Status status : disease.GetPopulationData().status) {
+    status_counts[status]++;
+  }
+  return status_counts;
+}
+
+bool HaveSameCounts(const StatusCounts& first, const StatusCounts& second) {
+  for (size_t status = 0; status < StatusCounts::kNumOfStatuses; status++) {
+    if (first.counts[status] != second.counts[status]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_CASE("Status transitions are recorded and applied to counts") {
+  StatusTransitions transitions;
+  transitions.Reset(3);
+
+  SECTION("Nothing recorded after a reset") {
+    REQUIRE(transitions.IsEmpty());
+  }
+
+  SECTION("Changes are sorted into population order") {
+    transitions.Record(2, 2, Status::kSymptomatic, Status::kRemoved);
+    transitions.Record(0, 0, Status::kSusceptible, Status::kAsymptomatic);
+    transitions.SortByIndex();
+
+    REQUIRE(transitions.Size() == 2);
+    REQUIRE(transitions[0].index == 0);
+    REQUIRE(transitions[0].to == Status::kAsymptomatic);
+    REQUIRE(transitions[1].index == 2);
+    REQUIRE(transitions[1].from == Status::kSymptomatic);
+  }
+
+  SECTION("Changes move people between counts") {
+    StatusCounts status_counts;
+    status_counts[Status::kSusceptible] = 2;
+    status_counts[Status::kSymptomatic] = 1;
+
+    transitions.Record(2, 2, Status::kSymptomatic, Status::kRemoved);
+    transitions.Record(0, 0, Status::kSusceptible, Status::kAsymptomatic);
+    transitions.ApplyTo(status_counts);
+
+    REQUIRE(status_counts[Status::kSusceptible] == 1);
+    REQUIRE(status_counts[Status::kSymptomatic] == 0);
+    REQUIRE(status_counts[Status::kAsymptomatic] == 1);
+    REQUIRE(status_counts[Status::kRemoved] == 1);
+  }
+}
+
+TEST_CASE("Disease keeps its status counts up to date") {
+  Disease disease = Disease(0, 0, 100, 100, vec2(150, 0), vec2(250, 100),
+                            vec2(45, 45), vec2(55, 55), 1, 3,
+                            false, true, false, false, false, false);
+
+  SECTION("Counts after creating the population") {
+    disease.CreatePopulation();
+
+    REQUIRE(disease.GetStatusCounts()[Status::kSusceptible] == 200);
+    REQUIRE(disease.GetStatusCounts()[Status::kSymptomatic] == 1);
+    REQUIRE(disease.GetStatusCounts().GetTotal() == 201);
+  }
+
+  SECTION("Infection and removal are recorded") {
+    vector<Disease::Person> people;
+    people.push_back(MakePerson(vec2(20, 20), Status::kSusceptible));
+    people.push_back(MakePerson(vec2(80, 80), Status::kSymptomatic));
+    people.push_back(MakePerson(vec2(25, 20), Status::kSymptomatic));
+    people[1].time_infected = 2;
+    disease.SetPopulation(people);
+
+    REQUIRE(disease.GetStatusCounts()[Status::kSusceptible] == 1);
+    REQUIRE(disease.GetStatusCounts()[Status::kSymptomatic] == 2);
+
+    disease.UpdateParticles();
+
+    const StatusTransitions& transitions = disease.GetStatusTransitions();
+    REQUIRE(transitions.Size() == 2);
+    REQUIRE(transitions[0].index == 0);
+    REQUIRE(transitions[0].id == 0);
+    REQUIRE(transitions[0].from == Status::kSusceptible);
+    REQUIRE(transitions[0].to == Status::kSymptomatic);
+    REQUIRE(transitions[1].index == 1);
+    REQUIRE(transitions[1].from == Status::kSymptomatic);
+    REQUIRE(transitions[1].to == Status::kRemoved);
+
+    REQUIRE(disease.GetStatusCounts()[Status::kSusceptible] == 0);
+    REQUIRE(disease.GetStatusCounts()[Status::kSymptomatic] == 2);
+    REQUIRE(disease.GetStatusCounts()[Status::kRemoved] == 1);
+
+    disease.UpdateParticles();
+    REQUIRE(disease.GetStatusTransitions().IsEmpty());
+  }
+
+  SECTION("Counts match the population after many ticks") {
+    Disease random_disease = Disease(0, 0, 580, 550, vec2(595, 380), vec2(1270, 630),
+                                     vec2(250, 290), vec2(350, 390));
+    random_disease.SetShouldQuarantine(true);
+    random_disease.SetRadiusOfInfection(30);
+    random_disease.SetInfectedTime(250);
+    random_disease.SetHaveCentralLocation(true);
+
+    SECTION("Updated serially") {}
+    SECTION("Updated in two phases") {
+      random_disease.SetShouldUpdateInTwoPhases(true);
+      random_disease.SetNumOfThreads(3);
+    }
+
+    random_disease.CreatePopulation();
+    bool counts_match = true;
+    for (size_t tick = 0; tick < 400; tick++) {
+      random_disease.UpdateParticles();
+      counts_match = counts_match &&
+                     HaveSameCounts(random_disease.GetStatusCounts(), CountEveryone(random_disease));
+    }
+
+    REQUIRE(counts_match);
+    REQUIRE(random_disease.GetStatusCounts()[Status::kRemoved] != 0);
+  }
+
+  SECTION("Counts are cleared with the population") {
+    disease.CreatePopulation();
+    disease.SetPopulation(vector<Disease::Person>());
+
+    REQUIRE(disease.GetStatusCounts().GetTotal() == 0);
+  }
+}
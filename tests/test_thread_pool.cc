@@ -0,0 +1,93 @@
+#include <core/thread_pool.h>
+
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <thread>
+
+using disease::ThreadPool;
+using std::vector;
+
+namespace {
+
+/*
+ * Runs a loop over the specified number of items and counts how many times
+ * each index was visited.
+ */
+vector<size_t> CountVisits(ThreadPool& pool, size_t num_of_items) {
+  vector<size_t> num_of_visits(num_of_items, 0);
+  auto visit = [&](size_t index) { num_of_visits[index]++; };
+  pool.ParallelFor(num_of_items, visit);
+  return num_of_visits;
+}
+
+}  // namespace
+
+TEST_CASE("Thread pool visits every index once") {
+  SECTION("Calling thread only") {
+    ThreadPool pool(1);
+
+    REQUIRE(pool.GetNumOfThreads() == 1);
+    REQUIRE(CountVisits(pool, 10) == vector<size_t>(10, 1));
+  }
+
+  SECTION("More items than threads") {
+    ThreadPool pool(4);
+
+    REQUIRE(pool.GetNumOfThreads() == 4);
+    REQUIRE(CountVisits(pool, 1001) == vector<size_t>(1001, 1));
+  }
+
+  SECTION("Fewer items than threads") {
+    ThreadPool pool(8);
+
+    REQUIRE(CountVisits(pool, 3) == vector<size_t>(3, 1));
+    REQUIRE(CountVisits(pool, 0).empty());
+  }
+
+  SECTION("Pool can run many loops") {
+    ThreadPool pool(3);
+    vector<size_t> num_of_visits(100, 0);
+    auto visit = [&](size_t index) { num_of_visits[index]++; };
+
+    for (size_t loop = 0; loop < 200; loop++) {
+      pool.ParallelFor(num_of_visits.size(), visit);
+    }
+
+    REQUIRE(num_of_visits == vector<size_t>(100, 200));
+  }
+}
+
+TEST_CASE("Balanced loops visit every index once") {
+  SECTION("Calling thread only") {
+    ThreadPool pool(1);
+    vector<size_t> num_of_visits(10, 0);
+    auto visit = [&](size_t index) { num_of_visits[index]++; };
+    pool.ParallelForBalanced(num_of_visits.size(), visit);
+
+    REQUIRE(num_of_visits == vector<size_t>(10, 1));
+  }
+
+  SECTION("Uneven items on several threads") {
+    ThreadPool pool(4);
+    vector<size_t> num_of_visits(37, 0);
+    auto visit = [&](size_t index) {
+      if (index % 5 == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      num_of_visits[index]++;
+    };
+    pool.ParallelForBalanced(num_of_visits.size(), visit);
+
+    REQUIRE(num_of_visits == vector<size_t>(37, 1));
+  }
+
+  SECTION("Fewer items than threads") {
+    ThreadPool pool(8);
+    vector<size_t> num_of_visits(3, 0);
+    auto visit = [&](size_t index) { num_of_visits[index]++; };
+    pool.ParallelForBalanced(num_of_visits.size(), visit);
+
+    REQUIRE(num_of_visits == vector<size_t>(3, 1));
+  }
+}
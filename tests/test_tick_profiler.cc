@@ -0,0 +1,133 @@
+#include <core/infectious_disease.h>
+#include <core/tick_profiler.h>
+
+#include <catch2/catch.hpp>
+
+#include <thread>
+
+using disease::Disease;
+using disease::ScopedPhaseTimer;
+using disease::TickPhase;
+using disease::TickProfile;
+using disease::TickProfiler;
+
+TEST_CASE("Tick profiles are averaged", "[tick profiler]") {
+  TickProfiler profiler;
+
+  SECTION("Nothing is averaged before a tick ends") {
+    profiler.StartTick();
+    profiler.AddTime(TickPhase::kMovement, 5000);
+
+    TickProfile profile = profiler.GetRecentAverage();
+    REQUIRE(profile.num_of_ticks == 0);
+    REQUIRE(profile.GetMicroseconds(TickPhase::kMovement) == 0);
+  }
+
+  SECTION("Times and pair tests are averaged per tick") {
+    for (size_t tick = 1; tick <= 2; tick++) {
+      profiler.StartTick();
+      profiler.AddTime(TickPhase::kResetFrame, tick * 1000);
+      profiler.AddPairTests(tick);
+      profiler.EndTick();
+    }
+
+    TickProfile profile = profiler.GetRecentAverage();
+    REQUIRE(profile.num_of_ticks == 2);
+    REQUIRE(profile.GetMicroseconds(TickPhase::kResetFrame) == Approx(1.5));
+    REQUIRE(profile.GetMicroseconds(TickPhase::kStatusUpdate) == 0);
+    REQUIRE(profile.pair_tests == Approx(1.5));
+  }
+
+  SECTION("Only the most recent ticks are in the recent average") {
+    for (size_t tick = 0; tick < TickProfiler::kNumOfTicksAveraged; tick++) {
+      profiler.StartTick();
+      profiler.AddTime(TickPhase::kTick, 1000);
+      profiler.EndTick();
+    }
+    for (size_t tick = 0; tick < TickProfiler::kNumOfTicksAveraged; tick++) {
+      profiler.StartTick();
+      profiler.AddTime(TickPhase::kTick, 3000);
+      profiler.EndTick();
+    }
+
+    REQUIRE(profiler.GetRecentAverage().num_of_ticks == TickProfiler::kNumOfTicksAveraged);
+    REQUIRE(profiler.GetRecentAverage().GetMicroseconds(TickPhase::kTick) == Approx(3));
+    REQUIRE(profiler.GetOverallAverage().num_of_ticks == 2 * TickProfiler::kNumOfTicksAveraged);
+    REQUIRE(profiler.GetOverallAverage().GetMicroseconds(TickPhase::kTick) == Approx(2));
+  }
+
+  SECTION("Clearing removes every tick") {
+    profiler.StartTick();
+    profiler.AddTime(TickPhase::kTick, 1000);
+    profiler.EndTick();
+    profiler.Clear();
+
+    REQUIRE(profiler.GetRecentAverage().num_of_ticks == 0);
+    REQUIRE(profiler.GetOverallAverage().num_of_ticks == 0);
+  }
+}
+
+TEST_CASE("Scoped phase timers add the time they were alive", "[tick profiler]") {
+  TickProfiler profiler;
+  profiler.StartTick();
+  {
+    ScopedPhaseTimer timer(profiler, TickPhase::kWallCollisions);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  profiler.EndTick();
+
+  TickProfile profile = profiler.GetRecentAverage();
+  REQUIRE(profile.GetMicroseconds(TickPhase::kWallCollisions) >= 2000);
+  REQUIRE(profile.GetMicroseconds(TickPhase::kMovement) == 0);
+}
+
+TEST_CASE("Updating the particles fills in the tick profile", "[tick profiler]") {
+  Disease disease = Disease(0, 0, 580, 550, vec2(595, 380), vec2(1270, 630),
+                            vec2(250, 290), vec2(350, 390));
+  disease.SetPercentPerformingSocialDistance(50);
+  disease.CreatePopulation();
+  for (size_t tick = 0; tick < 10; tick++) {
+    disease.UpdateParticles();
+  }
+
+  TickProfile profile = disease.GetTickProfiler().GetOverallAverage();
+
+  if (TickProfiler::kIsEnabled) {
+    REQUIRE(profile.num_of_ticks == 10);
+    REQUIRE(profile.GetMicroseconds(TickPhase::kTick) > 0);
+    REQUIRE(profile.GetMicroseconds(TickPhase::kTick) >= profile.GetMicroseconds(TickPhase::kMovement));
+    REQUIRE(profile.pair_tests > 0);
+    REQUIRE(profile.allocations == 0);
+  } else {
+    // Profiling is compiled out, so the ticks aren't collected
+    REQUIRE(profile.num_of_ticks == 0);
+  }
+}
+
+TEST_CASE("Sorting the population is timed as its own phase", "[tick profiler]") {
+  Disease disease = Disease(0, 0, 580, 550, vec2(595, 380), vec2(1270, 630),
+                            vec2(250, 290), vec2(350, 390));
+  disease.CreatePopulation();
+
+  SECTION("Nothing is timed when the population isn't sorted") {
+    for (size_t tick = 0; tick < 10; tick++) {
+      disease.UpdateParticles();
+    }
+
+    REQUIRE(disease.GetTickProfiler().GetOverallAverage().GetMicroseconds(TickPhase::kReorder) == 0);
+  }
+
+  SECTION("Sorting is timed apart from resetting the frame") {
+    disease.SetReorderInterval(1);
+    for (size_t tick = 0; tick < 10; tick++) {
+      disease.UpdateParticles();
+    }
+
+    TickProfile profile = disease.GetTickProfiler().GetOverallAverage();
+    if (TickProfiler::kIsEnabled) {
+      REQUIRE(profile.GetMicroseconds(TickPhase::kReorder) > 0);
+    } else {
+      REQUIRE(profile.GetMicroseconds(TickPhase::kReorder) == 0);
+    }
+  }
+}
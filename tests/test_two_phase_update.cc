@@ -0,0 +1,86 @@
+#include <core/infectious_disease.h>
+
+#include <catch2/catch.hpp>
+
+#include "make_person.h"
+#include "run_all_features.h"
+
+using disease::Direction;
+using disease::Disease;
+using disease::Status;
+
+TEST_CASE("Two phase updates only use the start of the tick") {
+  Disease disease = Disease(0, 0, 100, 100, vec2(150, 0), vec2(250, 100),
+                            vec2(45, 45), vec2(55, 55));
+  disease.SetShouldUpdateInTwoPhases(true);
+
+  SECTION("Susceptible people before the infected person are exposed") {
+    vector<Disease::Person> people;
+    people.push_back(MakePerson(vec2(50, 50), Status::kSusceptible));
+    people.push_back(MakePerson(vec2(55, 50), Status::kSymptomatic));
+    people.push_back(MakePerson(vec2(60, 50), Status::kSusceptible));
+    disease.SetPopulation(people);
+
+    disease.UpdateParticles();
+    vector<Disease::Person> updated_people = disease.GetPopulation();
+
+    REQUIRE(updated_people[0].continuous_exposure_time == 1);
+    REQUIRE(updated_people[2].continuous_exposure_time == 1);
+  }
+
+  SECTION("People infected during the tick don't expose anyone until the next tick") {
+    disease.SetExposureTime(1);
+    vector<Disease::Person> people;
+    people.push_back(MakePerson(vec2(10, 50), Status::kSymptomatic));
+    people.push_back(MakePerson(vec2(15, 50), Status::kSusceptible));
+    people.push_back(MakePerson(vec2(30, 50), Status::kSusceptible));
+    disease.SetPopulation(people);
+
+    disease.UpdateParticles();
+    vector<Disease::Person> updated_people = disease.GetPopulation();
+
+    REQUIRE(updated_people[1].status != Status::kSusceptible);
+    REQUIRE(updated_people[2].status == Status::kSusceptible);
+    REQUIRE(updated_people[2].continuous_exposure_time == 0);
+  }
+
+  SECTION("Everyone in the bubble is counted from where they started") {
+    vector<Disease::Person> people;
+    people.push_back(MakePerson(vec2(50, 50), Status::kSusceptible));
+    people.push_back(MakePerson(vec2(45, 50), Status::kSusceptible));
+    people.push_back(MakePerson(vec2(55, 47), Status::kSusceptible));
+    people.push_back(MakePerson(vec2(56, 52), Status::kSusceptible));
+    people[0].velocity = vec2(1, 0);
+    people[0].is_social_distancing = true;
+    disease.SetPopulation(people);
+
+    disease.UpdateParticles();
+    Disease::Person updated_person = disease.GetPopulation()[0];
+
+    REQUIRE(updated_person.positions_of_people_in_bubble[Direction::kLeft] == 1);
+    REQUIRE(updated_person.positions_of_people_in_bubble[Direction::kRight] == 2);
+    REQUIRE(updated_person.positions_of_people_in_bubble[Direction::kUp] == 1);
+    REQUIRE(updated_person.positions_of_people_in_bubble[Direction::kDown] == 1);
+    REQUIRE(updated_person.velocity.x < 0);
+  }
+}
+
+TEST_CASE("Two phase updates are the same on any number of threads") {
+  vector<Disease::Person> single_thread_people = RunAllFeatures(true, 1, 0, 300).GetPopulation();
+
+  for (size_t num_of_threads : {2, 3, 8}) {
+    vector<Disease::Person> people = RunAllFeatures(true, num_of_threads, 0, 300).GetPopulation();
+
+    bool is_same = true;
+    for (size_t index = 0; index < people.size(); index++) {
+      is_same = is_same && people[index].position == single_thread_people[index].position &&
+                people[index].velocity == single_thread_people[index].velocity &&
+                people[index].status == single_thread_people[index].status &&
+                people[index].time_infected == single_thread_people[index].time_infected;
+    }
+
+    INFO("threads: " << num_of_threads);
+    REQUIRE(people.size() == single_thread_people.size());
+    REQUIRE(is_same);
+  }
+}